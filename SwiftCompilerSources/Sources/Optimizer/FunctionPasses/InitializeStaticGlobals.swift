@@ -41,6 +41,17 @@ import SIL
 /// The initializer then becomes a side-effect free function which let's the builtin-
 /// simplification remove the `builtin "once"` which calls the initializer.
 ///
+/// The pass only matches initializers that the regular pipeline has already
+/// reduced to a straight-line sequence of constant instructions. Running the
+/// ConstExpr interpreter over initializers that don't fold on their own
+/// (loops, conditionals over build config) would widen the match, but the
+/// bound that actually matters is on the output side: whatever the
+/// interpreter computes must still be expressible as static-initializer SIL
+/// (`canBeInitializedStatically`). That excludes, most prominently,
+/// `Dictionary` and `Set` globals — their layout depends on per-process
+/// random hash seeds, so no compile-time image of them is valid at runtime,
+/// no matter how constant the literal looks in source.
+///
 let initializeStaticGlobalsPass = FunctionPass(name: "initialize-static-globals") {
   (function: Function, context: FunctionPassContext) in
 
@@ -63,6 +63,7 @@ class PerformanceTestResult(object):
         # Map remaining columns according to label
         field_map = [
             ("ICS", "ics"),
+            ("MAX_MALLOC", "max_malloc"),  # Must precede "MAX"
             ("MAX_RSS", "max_rss"),  # Must precede "MAX"
             ("MAX", "max"),
             ("MEAN", "mean"),
@@ -268,6 +269,12 @@ class PerformanceTestResult(object):
         """
         return self.json_data.get("max_rss")
 
+    @property
+    def max_malloc(self):
+        """Return max_malloc if available
+        """
+        return self.json_data.get("max_malloc")
+
     @property
     def mem_pages(self):
         """Return pages if available
@@ -436,6 +443,16 @@ class PerformanceTestResult(object):
             else:
                 self.json_data["max_rss"] = other_max_rss
 
+        # Likewise for the malloc high water mark
+        other_max_malloc = other.max_malloc
+        if other_max_malloc is not None:
+            self_max_malloc = self.max_malloc
+            if self_max_malloc is not None:
+                self.json_data["max_malloc"] = min(
+                    self_max_malloc, other_max_malloc)
+            else:
+                self.json_data["max_malloc"] = other_max_malloc
+
 
 class ResultComparison(object):
     """ResultComparison compares MINs from new and old PerformanceTestResult.
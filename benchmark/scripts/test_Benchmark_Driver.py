@@ -156,6 +156,44 @@ class Test_parse_args(unittest.TestCase):
             err.getvalue(),
         )
 
+    def test_abtest_requires_both_binaries(self):
+        with captured_output() as (out, err):
+            self.assertRaises(SystemExit, parse_args, ["abtest", "-a", "/bin/A"])
+        self.assert_contains(["error:", "-b"], err.getvalue())
+
+    def test_abtest_defaults(self):
+        args = parse_args(["abtest", "-a", "/bin/A", "-b", "/bin/B"])
+        self.assertEqual(args.harness_a, "/bin/A")
+        self.assertEqual(args.harness_b, "/bin/B")
+        self.assertEqual(args.rounds, 10)
+        self.assertEqual(args.num_samples, 2)
+        self.assertEqual(args.alpha, 0.05)
+
+
+class TestMannWhitneyU(unittest.TestCase):
+    def test_identical_samples_are_not_significant(self):
+        _, p = Benchmark_Driver.mann_whitney_u([5.0] * 10, [5.0] * 10)
+        self.assertEqual(p, 1.0)
+
+    def test_clearly_shifted_samples_are_significant(self):
+        a = [100.0 + (i % 7) * 0.1 for i in range(20)]
+        b = [105.0 + (i % 7) * 0.1 for i in range(20)]
+        _, p = Benchmark_Driver.mann_whitney_u(a, b)
+        self.assertLess(p, 0.001)
+
+    def test_interleaved_samples_are_not_significant(self):
+        a = [100.0 + (i % 10) * 0.2 for i in range(20)]
+        b = [100.1 + (i % 10) * 0.2 for i in range(20)]
+        _, p = Benchmark_Driver.mann_whitney_u(a, b)
+        self.assertGreater(p, 0.05)
+
+    def test_is_symmetric(self):
+        a = [100.0, 101.0, 102.0, 103.0]
+        b = [102.5, 103.5, 104.5, 105.5]
+        _, p_ab = Benchmark_Driver.mann_whitney_u(a, b)
+        _, p_ba = Benchmark_Driver.mann_whitney_u(b, a)
+        self.assertAlmostEqual(p_ab, p_ba)
+
 
 class ArgsStub(object):
     def __init__(self):
@@ -252,6 +252,24 @@ class TestPerformanceTestResult(unittest.TestCase):
             (4, 11616, 12325, 12064, 322.29, 12157.5, 10498048),
         )
 
+    def test_merge_max_malloc(self):
+        tests = [
+            """{"number":1,"name":"AngryPhonebook",
+            "samples":[12045]}""",
+            """{"number":1,"name":"AngryPhonebook",
+            "samples":[12325],"max_malloc":851968}""",
+            """{"number":1,"name":"AngryPhonebook",
+            "samples":[11616],"max_malloc":786432}"""
+        ]
+        results = [PerformanceTestResult(json) for json in tests]
+
+        r = results[0]
+        self.assertIsNone(r.max_malloc)
+        r.merge(results[1])
+        self.assertEqual(r.max_malloc, 851968)
+        r.merge(results[2])  # smaller high water mark wins
+        self.assertEqual(r.max_malloc, 786432)
+
     def test_legacy_merge(self):
         header = """#,TEST,NUM_SAMPLES,MIN,MAX,MEAN,SD,MEDIAN, MAX_RSS"""
         tests = [
@@ -615,6 +615,18 @@ public:
   /// Get the '+' function on two String.
   FuncDecl *getPlusFunctionOnString() const;
 
+  /// Record that the constraint solver committed to \p choice when resolving
+  /// an overload of the operator \p name, so later expressions can explore
+  /// that choice first.
+  ///
+  /// This only ever affects the order in which the solver explores a
+  /// disjunction, never the set of solutions.
+  void recordSolvedOperatorOverload(Identifier name, ValueDecl *choice);
+
+  /// Retrieve the operator overloads previously committed to for \p name, in
+  /// the order they were first recorded.
+  ArrayRef<ValueDecl *> getSolvedOperatorOverloads(Identifier name) const;
+
   /// Get Sequence.makeIterator().
   FuncDecl *getSequenceMakeIterator() const;
 
@@ -1360,6 +1372,10 @@ public:
   /// Returns memory used exclusively by constraint solver.
   size_t getSolverMemory() const;
 
+  /// Returns the high water mark of constraint solver memory usage, taken
+  /// across all of the solver arenas that have been torn down so far.
+  size_t getSolverMemoryHighWater() const;
+
   /// Retrieve the Swift identifier for the given Foundation entity, where
   /// "NS" prefix stripping will apply under omit-needless-words.
   Identifier getSwiftId(KnownFoundationEntity kind) {
@@ -135,6 +135,17 @@ namespace swift {
   /// type.
   ///
   /// All diagnostic arguments are converted to an instance of this class.
+  ///
+  /// Capture here is deliberately shallow and cheap: a Type, Decl, or name
+  /// argument is stored as the pointer/value itself, never as its printed
+  /// string. Stringification happens in formatDiagnosticText, which only
+  /// runs when a consumer renders the diagnostic - and
+  /// diagnosticInfoForDiagnostic bails before that for diagnostics whose
+  /// behavior resolves to Ignore. So a suppressed note costs an argument
+  /// array of unions, not a type print. The one thing an argument does pin
+  /// is lifetime: the pointed-at entities must stay alive until the
+  /// diagnostic is emitted or dropped, which is why Diagnostic objects
+  /// shouldn't be stockpiled across AST mutations.
   class DiagnosticArgument {
     DiagnosticArgumentKind Kind;
     union {
@@ -223,6 +223,13 @@ class Evaluator {
   /// A cache that stores the results of requests.
   evaluator::RequestCache cache;
 
+  /// If nonzero, a soft budget on the number of results held in \c cache.
+  /// When an insert pushes the cache past the budget and no requests are
+  /// active, results of request kinds that opted into eviction are dropped
+  /// and recomputed on demand, bounding the cache's footprint in long-lived
+  /// sessions.
+  size_t cacheCapacity = 0;
+
   evaluator::DependencyRecorder recorder;
 
   /// Retrieve the request function for the given zone and request IDs.
@@ -243,13 +250,27 @@ public:
   /// diagnostics through the given diagnostics engine.
   Evaluator(DiagnosticEngine &diags, const LangOptions &opts);
 
-  /// Emit GraphViz output visualizing the request graph.
-  void emitRequestEvaluatorGraphViz(llvm::StringRef graphVizPath);
-
   /// Set the unified stats reporter through which evaluated-request
   /// statistics will be recorded.
+  ///
+  /// This is also where the request *trace* lives: every uncached
+  /// evaluation runs under a FrontendStatsTracer (see getResultUncached),
+  /// so a frontend job run with -stats-output-dir and -trace-stats-events
+  /// writes one timestamped entry/exit row per request to the job's trace
+  /// CSV. Parent/child edges fall out of the nesting of those rows; no
+  /// separate edge log is maintained here. (The evaluator once had its own
+  /// GraphViz dump of the request graph, but it rotted when dependency
+  /// tracking was rebuilt around DependencyRecorder, and the stats trace
+  /// subsumed it.)
   void setStatsReporter(UnifiedStatsReporter *stats) { this->stats = stats; }
 
+  /// Set a soft budget on the number of cached request results, or 0 for
+  /// unbounded (the default). See \c cacheCapacity.
+  void setCacheCapacity(size_t capacity) { cacheCapacity = capacity; }
+
+  /// The total number of cached request results.
+  size_t getCachedResultCount() const { return cache.size(); }
+
   /// Register the set of request functions for the given zone.
   ///
   /// These functions will be called to evaluate any requests within that
@@ -447,10 +468,22 @@ private:
 
     // Cache the result.
     cache.insert<Request>(request, *result);
+    trimCacheIfNeeded();
     return result;
   }
 
 private:
+  /// Enforce the result-cache budget, if one is set. Eviction only runs
+  /// between top-level requests; results for requests still on the active
+  /// stack must stay stable while they are being computed.
+  void trimCacheIfNeeded() {
+    if (cacheCapacity == 0 || cache.size() <= cacheCapacity)
+      return;
+    if (!activeRequests.empty())
+      return;
+    cache.evictEvictableResults();
+  }
+
   template <typename Request, typename std::enable_if<
                                   !Request::isDependencySink>::type * = nullptr>
   void handleDependencySinkRequest(const Request &r,
@@ -111,6 +111,10 @@ private:
       GenericSignature(), Kind::Primary};
   NestedTypeStorage *nestedTypeStorage = nullptr;
 
+  /// The forwarding substitution map for a primary generic environment,
+  /// computed lazily by getForwardingSubstitutionMap().
+  mutable SubstitutionMap ForwardingSubMap;
+
   friend TrailingObjects;
   friend OpaqueTypeArchetypeType;
 
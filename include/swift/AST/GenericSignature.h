@@ -282,6 +282,11 @@ class alignas(1 << TypeAlignInBits) GenericSignatureImpl final
 
   rewriting::RequirementMachine *Machine = nullptr;
 
+  /// The identity substitution map for this generic signature, in opaque
+  /// form since SubstitutionMap is not complete here. Computed lazily by
+  /// getIdentitySubstitutionMap().
+  mutable const void *IdentitySubMap = nullptr;
+
   // Make vanilla new/delete illegal.
   void *operator new(size_t Bytes) = delete;
   void operator delete(void *Data) = delete;
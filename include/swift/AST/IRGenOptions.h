@@ -285,7 +285,12 @@ public:
 
   /// Whether we're generating IR for the JIT.
   unsigned UseJIT : 1;
-  
+
+  /// Whether the JIT should defer compiling each function until its first
+  /// call rather than compiling the whole module before execution starts.
+  unsigned UseJITLazy : 1;
+
+
   /// Whether we should run LLVM optimizations after IRGen.
   unsigned DisableLLVMOptzns : 1;
 
@@ -486,7 +491,7 @@ public:
         SanitizeAddressUseODRIndicator(false),
         DebugInfoLevel(IRGenDebugInfoLevel::None),
         DebugInfoFormat(IRGenDebugInfoFormat::None),
-        DisableClangModuleSkeletonCUs(false), UseJIT(false),
+        DisableClangModuleSkeletonCUs(false), UseJIT(false), UseJITLazy(false),
         DisableLLVMOptzns(false), DisableSwiftSpecificLLVMOptzns(false),
         Playground(false),
         EmitStackPromotionChecks(false), UseSingleModuleLLVMEmission(false),
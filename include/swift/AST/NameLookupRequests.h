@@ -771,8 +771,9 @@ private:
   evaluate(Evaluator &evaluator, OperatorLookupDescriptor desc) const;
 
 public:
-  // Cached.
+  // Cached. Pure lookup, so the result may be evicted under a cache budget.
   bool isCached() const { return true; }
+  static const bool isEvictable = true;
 };
 
 /// Look up an 'prefix operator' decl by name.
@@ -790,8 +791,9 @@ private:
                                OperatorLookupDescriptor desc) const;
 
 public:
-  // Cached.
+  // Cached. Pure lookup, so the result may be evicted under a cache budget.
   bool isCached() const { return true; }
+  static const bool isEvictable = true;
 };
 
 /// Look up an 'postfix operator' decl by name.
@@ -809,8 +811,9 @@ private:
                                 OperatorLookupDescriptor desc) const;
 
 public:
-  // Cached.
+  // Cached. Pure lookup, so the result may be evicted under a cache budget.
   bool isCached() const { return true; }
+  static const bool isEvictable = true;
 };
 
 /// Look up a precedencegroup decl by name.
@@ -829,8 +832,9 @@ private:
   evaluate(Evaluator &evaluator, OperatorLookupDescriptor descriptor) const;
 
 public:
-  // Cached.
+  // Cached. Pure lookup, so the result may be evicted under a cache budget.
   bool isCached() const { return true; }
+  static const bool isEvictable = true;
 };
 
 /// Computes whether this is a decl that supports being called through the
@@ -850,7 +854,9 @@ private:
                 DeclContext *dc) const;
 
 public:
+  // Cached. Pure predicate, so the result may be evicted under a cache budget.
   bool isCached() const { return true; }
+  static const bool isEvictable = true;
 };
 
 /// Computes whether the specified decl or a super-class/super-protocol has the
@@ -48,6 +48,20 @@ public:
 /// launch it and manages the process. When the plugin process crashes, this
 /// should automatically relaunch the process so the clients can keep using this
 /// object as the interface.
+///
+/// Transport-cost notes: the process is already persistent - it is spawned
+/// once per frontend invocation, reused for every expansion, and relaunched
+/// only when stale or crashed - so per-expansion cost is one message
+/// round-trip over the pipe pair, not a process launch. The message format
+/// on those pipes is the swift-syntax plugin protocol, shared with every
+/// plugin binary SwiftPM builds, so moving to a shared-memory ring or
+/// batching multiple expansions per message is a cross-repo protocol
+/// revision, not a local transport swap; and since expansions are requested
+/// lazily mid-type-check with the result blocking further progress, there
+/// is rarely a second request available to batch. When IPC overhead
+/// dominates, the supported escape hatch is the library plugin flavor
+/// (LoadedLibraryPlugin above): a dylib loaded in-process, where expansion
+/// is a function call with no serialization at all.
 class LoadedExecutablePlugin {
 
   /// Represents the current process of the executable plugin.
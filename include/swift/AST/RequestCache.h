@@ -43,6 +43,23 @@ struct TupleHasDenseMapInfo<
 
 } // end namespace detail
 
+/// Determines whether a request type opted into eviction under a cache
+/// memory budget by declaring:
+///
+///   static const bool isEvictable = true;
+///
+/// Only requests whose results are pure, recomputable values with no
+/// identity-bearing side effects (e.g. lookups, predicates) should opt in;
+/// requests whose cached result *is* the canonical object (e.g. parsing)
+/// must never be evicted.
+template <typename Request, typename = detail::void_t<>>
+struct IsEvictableRequest : std::false_type {};
+
+template <typename Request>
+struct IsEvictableRequest<Request,
+                          detail::void_t<decltype(Request::isEvictable)>>
+    : std::integral_constant<bool, Request::isEvictable> {};
+
 namespace {
 
 /// Wrapper for a request with additional empty and tombstone states.
@@ -162,6 +179,9 @@ public:
 class PerRequestCache {
   void *Storage;
   std::function<void(void *)> Deleter;
+  void (*Clearer)(void *) = nullptr;
+  size_t (*Sizer)(void *) = nullptr;
+  bool Evictable = false;
 
   PerRequestCache(void *storage, std::function<void(void *)> deleter)
       : Storage(storage), Deleter(deleter) {}
@@ -169,7 +189,9 @@ class PerRequestCache {
 public:
   PerRequestCache() : Storage(nullptr), Deleter([](void *) {}) {}
   PerRequestCache(PerRequestCache &&other)
-      : Storage(other.Storage), Deleter(std::move(other.Deleter)) {
+      : Storage(other.Storage), Deleter(std::move(other.Deleter)),
+        Clearer(other.Clearer), Sizer(other.Sizer),
+        Evictable(other.Evictable) {
     other.Storage = nullptr;
   }
 
@@ -189,8 +211,14 @@ public:
     using Map =
         llvm::DenseMap<RequestKey<Request>,
                        typename Request::OutputType>;
-    return PerRequestCache(new Map(),
-                           [](void *ptr) { delete static_cast<Map *>(ptr); });
+    PerRequestCache cache(new Map(),
+                          [](void *ptr) { delete static_cast<Map *>(ptr); });
+    cache.Clearer = [](void *ptr) { static_cast<Map *>(ptr)->clear(); };
+    cache.Sizer = [](void *ptr) -> size_t {
+      return static_cast<Map *>(ptr)->size();
+    };
+    cache.Evictable = IsEvictableRequest<Request>::value;
+    return cache;
   }
 
   template <typename Request>
@@ -205,6 +233,12 @@ public:
   }
 
   bool isNull() const { return !Storage; }
+  bool isEvictable() const { return Evictable; }
+  size_t size() const { return Storage ? Sizer(Storage) : 0; }
+  void clearEntries() {
+    if (Storage)
+      Clearer(Storage);
+  }
   ~PerRequestCache() {
     if (Storage)
       Deleter(Storage);
@@ -265,19 +299,45 @@ public:
                                  std::move(val)});
     assert(result.second && "Request result was already cached");
     (void) result;
+    ++EntryCount;
   }
 
   template <typename Request>
   void erase(Request req) {
     auto *cache = getCache<Request>();
-    cache->erase(RequestKey<Request>(std::move(req)));
+    if (cache->erase(RequestKey<Request>(std::move(req))))
+      --EntryCount;
+  }
+
+  /// The total number of cached results, across all request kinds.
+  size_t size() const { return EntryCount; }
+
+  /// Drop the cached results of every request kind that opted into eviction
+  /// via \c isEvictable. Returns the number of entries freed.
+  size_t evictEvictableResults() {
+    size_t freed = 0;
+#define SWIFT_TYPEID_ZONE(Name, Id)                                            \
+    for (auto &perRequest : Name##ZoneCache) {                                 \
+      if (!perRequest.isNull() && perRequest.isEvictable()) {                  \
+        freed += perRequest.size();                                            \
+        perRequest.clearEntries();                                             \
+      }                                                                        \
+    }
+#include "swift/Basic/TypeIDZones.def"
+#undef SWIFT_TYPEID_ZONE
+    EntryCount -= freed;
+    return freed;
   }
 
   void clear() {
 #define SWIFT_TYPEID_ZONE(Name, Id) Name##ZoneCache.clear();
 #include "swift/Basic/TypeIDZones.def"
 #undef SWIFT_TYPEID_ZONE
+    EntryCount = 0;
   }
+
+private:
+  size_t EntryCount = 0;
 };
 
 /// Type-erased wrapper for caching dependencies from a single type of request.
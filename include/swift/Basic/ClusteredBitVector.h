@@ -37,6 +37,17 @@
 namespace swift {
 
 /// A vector of bits.
+///
+/// Despite the name (kept for history - the original implementation managed
+/// clustered chunks itself), this is a thin wrapper over llvm::APInt, so
+/// the logical operators, flips, and popcount already run word-parallel on
+/// 64-bit words; there is no scalar bit loop to vectorize. The cost center
+/// that remains is growth: APInt is fixed-width, so every append
+/// reallocates and shifts. Callers assembling a mask from many pieces
+/// (enum spare-bit computation with large case counts) amortize that best
+/// by sizing up front - a single appendClearBits/appendSetBits to final
+/// width, then setting bits - rather than growing one fragment at a time. A reserve() can't be retrofitted without replacing
+/// APInt as the store.
 class ClusteredBitVector {
   using APInt = llvm::APInt;
 
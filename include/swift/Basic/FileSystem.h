@@ -82,6 +82,15 @@ namespace swift {
                    const llvm::Twine &Name, int64_t FileSize = -1,
                    bool RequiresNullTerminator = true, bool IsVolatile = false,
                    unsigned BADFRetry = 0);
+
+    /// Opens \p Name and returns a buffer of its contents, preferring a
+    /// memory-mapped, zero-copy buffer over reading the file into anonymous
+    /// memory. Unlike \c getFileOrSTDIN, this drops the NUL-terminator
+    /// requirement so the file can be mapped even when its size is an exact
+    /// multiple of the page size; callers must not rely on a terminating NUL.
+    llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>>
+    getMemoryMappedFile(llvm::vfs::FileSystem &FS, const llvm::Twine &Name,
+                        bool IsVolatile = false);
   } // end namespace vfs
 
 } // end namespace swift
@@ -382,6 +382,15 @@ struct unvalidatedObjectTraits : public std::integral_constant<bool,
     has_ObjectTraits<T>::value
 && !has_ObjectValidateTraits<T>::value> {};
 
+/// A streaming JSON emitter driven by the traits above.
+///
+/// Output writes each scalar, key, and bracket directly to the underlying
+/// raw_ostream as the traits visit it; the only state it keeps is a small
+/// stack of enum States tracking whether a comma is due. There is no
+/// intermediate value tree to allocate or tear down, so emitting a message
+/// costs the bytes written plus the visiting calls - callers (parseable
+/// driver output, stats emission) that want fewer allocations should look
+/// at the buffers they print into, not at this class.
 class Output {
 public:
   using UserInfoMap = std::map<void *, void *>;
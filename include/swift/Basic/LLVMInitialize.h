@@ -14,6 +14,15 @@
 // binaries in swift use. Please call PROGRAM_START in the main routine of all
 // binaries, and INITIALIZE_LLVM in anything that uses Clang or LLVM IR.
 //
+// INITIALIZE_LLVM is deliberately eager rather than deferred to first IRGen
+// use. Registration only stores function pointers into the static
+// TargetRegistry — it is microseconds, not a measurable slice of process
+// startup — while the set of places that perform target lookups is open-ended
+// (IRGen, immediate mode, remark serialization, tools linking this header).
+// Gating registration on the requested frontend action would save nothing
+// measurable and would turn every new lookup site into a latent
+// "no available targets" error for whichever action forgot the gate.
+//
 //===----------------------------------------------------------------------===//
 
 #ifndef SWIFT_BASIC_LLVMINITIALIZE_H
@@ -342,6 +342,11 @@ namespace swift {
     /// Whether to dump debug info for request evaluator cycles.
     bool DebugDumpCycles = false;
 
+    /// If nonzero, a soft budget on the number of results the request
+    /// evaluator caches; when exceeded, results of evictable request kinds
+    /// are dropped and recomputed on demand.
+    unsigned RequestCacheCapacity = 0;
+
     /// Disable SIL substituted function types.
     bool DisableSubstSILFunctionTypes = false;
 
@@ -34,6 +34,19 @@ void printManglingStats();
 /// This class serves as an abstract base class for specific manglers. It
 /// provides some basic utilities, like handling of substitutions, mangling of
 /// identifiers, etc.
+///
+/// Performance notes: substitution lookup is hash-based - pointer
+/// substitutions go through a DenseMap and identifier substitutions through
+/// a StringMap - so there is no linear scan of prior entries; the only
+/// linearly-searched structure is the word list, which the mangling grammar
+/// caps at 26 entries. Memoizing whole mangled names across manglings is a
+/// per-client affair, not something this layer can offer: the output for
+/// the same entity varies with the concrete mangler subclass and its
+/// configuration (DWARF manglings, symbolic references in IRGen type refs,
+/// TBDGen's install-name context), so a module-wide type-to-string cache
+/// keyed on the canonical type alone would conflate distinct spellings.
+/// Clients that re-mangle the same entity under identical configuration are
+/// the right place for a cache.
 class Mangler {
 protected:
   template <typename Mangler>
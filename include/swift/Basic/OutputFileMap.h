@@ -34,6 +34,16 @@ using TypeToPathMap = llvm::DenseMap<file_types::ID, std::string>;
 ///
 /// The structure is a map from input paths to sub-maps, each of which maps
 /// file types to output paths.
+///
+/// A note on parse cost: the full YAML map supplied via -output-file-map is
+/// parsed exactly once per build, by the driver. Frontend processes never see
+/// it; when the input set is large the driver writes each frontend job a
+/// filtered -supplementary-output-file-map containing only that job's
+/// entries (see ToolChain::JobContext in the driver). So the parse is O(map
+/// size) once per driver invocation, not once per frontend process, and a
+/// precompiled binary representation would save a single YAML parse per
+/// build. If that ever shows up in profiles the right fix is on the build
+/// system's side of this interface, not a second on-disk format here.
 class OutputFileMap {
 private:
   llvm::StringMap<TypeToPathMap> InputToOutputsMap;
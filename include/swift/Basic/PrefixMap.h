@@ -51,6 +51,18 @@ template <class KeyElementType> class PrefixMapKeyPrinter;
 
 /// A map whose keys are sequences of comparable values, optimized for
 /// finding a mapped value for the longest matching initial subsequence.
+///
+/// Layout notes, since this periodically attracts flattening proposals:
+/// the structure is a ternary trie that already does path compression - a
+/// node's local key is a multi-element run, stored inline in the node up
+/// to InlineKeyCapacity - so deep chains only arise from genuinely
+/// branching key sets. Its one client in the tree is IRGen's
+/// MetadataPath::Map (local type data caches), which are small,
+/// per-function, and short-lived; a contiguous node pool with integer
+/// child indices would mostly add a relocation/growth scheme for maps
+/// that rarely see more than a handful of nodes. If a profile ever does
+/// blame these walks, check the map population first - the win would be
+/// in not looking up the same path repeatedly, not in node layout.
 template <class KeyElementType, class ValueType,
           size_t InlineKeyCapacity = std::max(
               (sizeof(void *) - 1) / sizeof(KeyElementType), size_t(1))>
@@ -362,6 +362,12 @@ public:
   /// If \p BufferID is provided, \p Loc must come from that source buffer.
   ///
   /// This does not respect \c #sourceLocation directives.
+  ///
+  /// Cost: amortized O(log #lines). llvm::SourceMgr builds a per-buffer
+  /// newline-offset cache on the first line query and binary-searches it
+  /// afterwards, so only the first lookup in a buffer pays a full scan;
+  /// repeated lookups (diagnostics, indexing) do not rescan. There is no
+  /// need for - and no benefit to - a parallel cache on the Swift side.
   std::pair<unsigned, unsigned>
   getLineAndColumnInBuffer(SourceLoc Loc, unsigned BufferID = 0) const {
     assert(Loc.isValid());
@@ -69,6 +69,17 @@ namespace swift {
 /// The current implementation is the 128-bit (extended) SipHash 2-4, which
 /// has been empirically demonstrated to have the best throughput relative to
 /// the other SipHash tunings.
+///
+/// For anyone arriving here to speed up fingerprinting: this is not MD5.
+/// MD5 was retired from the incremental-dependency fingerprints when this
+/// hasher was introduced, and SipHash 2-4 runs a few 64-bit ALU rounds per
+/// word with no cryptographic finalization - on typical interface-hash
+/// inputs (token streams fed word-at-a-time through combine) the cost is
+/// dominated by walking the input, not by the hash. Swapping in a
+/// tree-hashing design like BLAKE3 pays off on long contiguous buffers, but
+/// would vendor a sizable dependency and invalidate every stored
+/// Fingerprint for a phase that profiles attribute little time to. Revisit
+/// only with a measurement that isolates hashing from tokenization.
 class StableHasher final {
 private:
   struct State {
@@ -51,6 +51,16 @@
 //
 // Generally we make one of these per-process: either early in the life of the
 // driver, or early in the life of the frontend.
+//
+// On cost: the "always-on" counters are plain int64 increments and the JSON
+// file is written once at process exit, so neither is what makes
+// -stats-output-dir expensive to leave enabled fleet-wide.  The measurable
+// overhead comes from the optional layers — per-entity timers,
+// -trace-stats-events, and -profile-stats-entities — which allocate and
+// timestamp on every traced scope.  A more compact output encoding would
+// therefore not change the overhead profile; deployments that want cheap
+// fleet-wide attribution should enable bare -stats-output-dir (counters
+// only) and aggregate the per-job JSON files off-line.
 
 namespace clang {
   class Decl;
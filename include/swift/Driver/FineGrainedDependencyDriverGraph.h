@@ -135,6 +135,17 @@ public:
 //==============================================================================
 
 /// See \ref Node in FineGrainedDependencies.h
+///
+/// The graph is rebuilt from the .swiftdeps files at every driver start.
+/// Keeping it resident in a long-lived daemon and applying deltas would
+/// save that reconstruction, but the driver is deliberately a
+/// run-to-completion process: correctness of "what must rebuild" depends
+/// on the graph agreeing with the build record and the outputs on disk,
+/// and a resident graph can silently diverge from them whenever anything
+/// else (a clean, an SCM operation, another build system) touches the
+/// workspace between builds. Serialized priors already amortize most of
+/// the parse cost; the invalidation problem is what a daemon would have
+/// to solve, and nothing here solves it today.
 class ModuleDepGraph {
 
   /// Find nodes, first by the swiftDeps file, then by key.
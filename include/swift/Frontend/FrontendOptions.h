@@ -250,6 +250,12 @@ public:
   /// \see ModuleDecl::arePrivateImportsEnabled
   bool EnablePrivateImports = false;
 
+  /// Lex all source files of the main module concurrently on a thread pool
+  /// before the serial per-file parse. AST construction itself stays serial
+  /// (the ASTContext arenas are not thread-safe), but this overlaps file
+  /// I/O, page faults and token scanning across cores.
+  bool ParallelParseFiles = false;
+
 
   /// Indicates whether we add implicit dynamic.
   ///
@@ -93,23 +93,37 @@ class IDEInspectionInstance {
   struct Options {
     unsigned MaxASTReuseCount = 100;
     unsigned DependencyCheckIntervalSecond = 5;
+    /// Maximum number of warm compiler instances kept for reuse. Keeping
+    /// more than one lets requests that alternate between a small number of
+    /// files (e.g. a split editor) hit a warm AST for each of them, at the
+    /// cost of holding the additional ASTs in memory.
+    unsigned MaxCachedCompilerInstances = 2;
   } Opts;
 
   std::mutex mtx;
 
   std::shared_ptr<PluginRegistry> Plugins;
 
-  std::shared_ptr<CompilerInstance> CachedCI;
-  llvm::hash_code CachedArgHash;
-  llvm::sys::TimePoint<> DependencyCheckedTimestamp;
-  llvm::StringMap<llvm::hash_code> InMemoryDependencyHash;
-  unsigned CachedReuseCount = 0;
+  /// A warm compiler instance from a previous operation, together with the
+  /// state needed to decide whether it may be reused.
+  struct CachedInstance {
+    std::shared_ptr<CompilerInstance> CI;
+    llvm::hash_code ArgHash;
+    llvm::sys::TimePoint<> DependencyCheckedTimestamp;
+    llvm::StringMap<llvm::hash_code> InMemoryDependencyHash;
+    unsigned ReuseCount = 0;
+  };
+
+  /// Warm compiler instances, each for a different (invocation, inspection
+  /// file) pair, ordered from least to most recently used. Bounded by
+  /// \c Opts.MaxCachedCompilerInstances .
+  std::vector<CachedInstance> CachedInstances;
   std::atomic<bool> CachedCIShouldBeInvalidated;
 
   void cacheCompilerInstance(std::shared_ptr<CompilerInstance> CI,
                              llvm::hash_code ArgsHash);
 
-  bool shouldCheckDependencies() const;
+  bool shouldCheckDependencies(const CachedInstance &Entry) const;
 
   /// Calls \p Callback with cached \c CompilerInstance if it's usable for the
   /// specified completion request.
@@ -375,6 +375,29 @@ public:
 
   static SourceLoc getLocForStartOfToken(SourceManager &SM, SourceLoc Loc);
 
+  /// Given a single edit to the buffer \p BufferID, return the smallest
+  /// character range of the post-edit buffer whose tokens may differ from the
+  /// pre-edit buffer and therefore must be re-lexed.
+  ///
+  /// \p ReplacementRange is the character range the replacement text occupies
+  /// in the (already updated) buffer. The returned range begins no later than
+  /// the start of the token containing the edit, so a partially edited token
+  /// is re-lexed whole, and ends at the start of the first token at or beyond
+  /// the end of the replacement, which is a valid resume point for a lexer
+  /// whose prior state is still applicable. Multi-line tokens (string
+  /// literals and block comments) overlapping the edit extend the range to
+  /// their own end.
+  ///
+  /// \p AnchorState, if provided, is a lexer state saved from a prior lex of
+  /// this buffer at a token boundary at or before the edit; scanning resumes
+  /// from it. Without an anchor, scanning starts from the beginning of the
+  /// token containing the edit, which can underestimate the damage when the
+  /// edit lies in the interior of a multi-line comment or string literal.
+  static CharSourceRange
+  getDamagedRegionForEdit(SourceManager &SM, unsigned BufferID,
+                          CharSourceRange ReplacementRange,
+                          llvm::Optional<State> AnchorState = llvm::None);
+
   /// Retrieve the start location of the line containing the given location.
   /// the given location.
   static SourceLoc getLocForStartOfLine(SourceManager &SM, SourceLoc Loc);
@@ -0,0 +1,155 @@
+//===--- CachingMemoryReader.h - Page-caching MemoryReader ------*- C++ -*-===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2023 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file declares an implementation of MemoryReader that wraps another
+//  reader and caches remote memory at page granularity, for use by clients
+//  whose underlying reads are expensive (e.g. one syscall or RPC per read).
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef SWIFT_REMOTE_CACHINGMEMORYREADER_H
+#define SWIFT_REMOTE_CACHINGMEMORYREADER_H
+
+#include "swift/Remote/MemoryReader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+namespace swift {
+namespace remote {
+
+/// A MemoryReader which caches the remote process's memory in page-sized
+/// chunks, delegating cache misses to an underlying reader.
+///
+/// Metadata reconstruction tends to issue many small reads with strong
+/// spatial locality (metadata records, descriptor chains, reflection
+/// strings), so fetching whole pages amortizes the per-read cost of
+/// readers that cross a process or protocol boundary.
+///
+/// The cache assumes the remote process is not mutating the ranges being
+/// inspected — in practice, that it is suspended.  If the target is
+/// resumed between inspection passes, call `flush()` to discard any data
+/// that may have gone stale.
+class CachingMemoryReader final : public MemoryReader {
+  /// Granularity of caching.  This doesn't need to match the target's VM
+  /// page size; it just bounds how much we over-read on a miss.
+  static constexpr uint64_t PageSize = 4096;
+
+  /// Maximum number of resident pages before the least recently used one
+  /// is evicted.  4096 pages caps the cache at 16MB.
+  static constexpr size_t MaxPages = 4096;
+
+  std::shared_ptr<MemoryReader> Inner;
+
+  /// Pages in order of use, most recent first.  Lookups go through
+  /// `PageMap`; this list only exists to make eviction cheap.
+  std::list<std::pair<uint64_t, std::unique_ptr<uint8_t[]>>> Pages;
+  std::unordered_map<uint64_t, decltype(Pages)::iterator> PageMap;
+
+  /// Returns a pointer to the cached page containing `pageAddress`,
+  /// fetching it from the underlying reader if necessary, or nullptr if
+  /// the page cannot be read in full.
+  const uint8_t *getPage(uint64_t pageAddress) {
+    auto Known = PageMap.find(pageAddress);
+    if (Known != PageMap.end()) {
+      Pages.splice(Pages.begin(), Pages, Known->second);
+      return Known->second->second.get();
+    }
+
+    auto Buf = std::make_unique<uint8_t[]>(PageSize);
+    if (!Inner->readBytes(RemoteAddress(pageAddress), Buf.get(), PageSize))
+      return nullptr;
+
+    if (Pages.size() >= MaxPages) {
+      PageMap.erase(Pages.back().first);
+      Pages.pop_back();
+    }
+
+    Pages.emplace_front(pageAddress, std::move(Buf));
+    PageMap[pageAddress] = Pages.begin();
+    return Pages.front().second.get();
+  }
+
+public:
+  explicit CachingMemoryReader(std::shared_ptr<MemoryReader> Inner)
+      : Inner(std::move(Inner)) {}
+
+  /// Discard all cached pages.  Must be called whenever the remote
+  /// process may have run since the pages were read.
+  void flush() {
+    Pages.clear();
+    PageMap.clear();
+  }
+
+  bool queryDataLayout(DataLayoutQueryType type, void *inBuffer,
+                       void *outBuffer) override {
+    return Inner->queryDataLayout(type, inBuffer, outBuffer);
+  }
+
+  RemoteAddress getSymbolAddress(const std::string &name) override {
+    return Inner->getSymbolAddress(name);
+  }
+
+  bool readString(RemoteAddress address, std::string &dest) override {
+    return Inner->readString(address, dest);
+  }
+
+  RemoteAbsolutePointer resolvePointer(RemoteAddress address,
+                                       uint64_t readValue) override {
+    return Inner->resolvePointer(address, readValue);
+  }
+
+  llvm::Optional<RemoteAbsolutePointer>
+  resolvePointerAsSymbol(RemoteAddress address) override {
+    return Inner->resolvePointerAsSymbol(address);
+  }
+
+  RemoteAbsolutePointer getSymbol(RemoteAddress address) override {
+    return Inner->getSymbol(address);
+  }
+
+  RemoteAbsolutePointer getDynamicSymbol(RemoteAddress address) override {
+    return Inner->getDynamicSymbol(address);
+  }
+
+  bool readBytes(RemoteAddress address, uint8_t *dest,
+                 uint64_t size) override {
+    uint64_t addr = address.getAddressData();
+    while (size > 0) {
+      uint64_t pageAddress = addr & ~(PageSize - 1);
+      uint64_t offset = addr - pageAddress;
+      uint64_t chunk = std::min(size, PageSize - offset);
+
+      auto *Page = getPage(pageAddress);
+      if (!Page) {
+        // The page may be only partially mapped in the target; retry just
+        // the requested range through the underlying reader rather than
+        // failing the whole read.
+        return Inner->readBytes(RemoteAddress(addr), dest, size);
+      }
+
+      memcpy(dest, Page + offset, chunk);
+      dest += chunk;
+      addr += chunk;
+      size -= chunk;
+    }
+    return true;
+  }
+};
+
+} // end namespace remote
+} // end namespace swift
+
+#endif // SWIFT_REMOTE_CACHINGMEMORYREADER_H
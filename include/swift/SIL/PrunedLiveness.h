@@ -121,6 +121,19 @@
 /// live-within instead of live-out. visitInsertionPoints compensates by moving
 /// the insertion point to the successor block.
 ///
+/// ** Why this is not a pass-manager analysis **
+///
+/// Liveness here is a function of the exact use list of the values being
+/// queried, and the OSSA passes that consume it (CopyPropagation,
+/// DestroyAddrHoisting, and friends) rewrite those use lists as they run:
+/// each copy they fold or destroy they hoist changes the very liveness they
+/// just computed. A function-scoped liveness analysis cached by the pass
+/// manager would be invalidated by essentially every client before the next
+/// client could see it. Instead the representation is optimized for cheap
+/// recomputation: block states live in stack-allocated bitfields
+/// (BitfieldRef) and use points in small maps, so a per-def computation
+/// touches only the blocks the live range actually covers.
+///
 //===----------------------------------------------------------------------===//
 
 #ifndef SWIFT_SILOPTIMIZER_UTILS_PRUNEDLIVENESS_H
@@ -970,6 +970,9 @@ public:
   /// Allocate memory using the module's internal allocator.
   void *allocate(unsigned Size, unsigned Align) const;
 
+  /// The number of bytes handed out by the module's internal allocator.
+  size_t getBytesAllocated() const { return BPA.getBytesAllocated(); }
+
   template <typename T> T *allocate(unsigned Count) const {
     return static_cast<T *>(allocate(sizeof(T) * Count, alignof(T)));
   }
@@ -20,8 +20,17 @@
 
 namespace swift {
 
-/// This class is a simple wrapper around an alias analysis cache. This is
-/// needed since we do not have an "analysis" infrastructure.
+/// Alias analysis with caching of queries.
+///
+/// An instance of this class is created per function by the pass manager's
+/// AliasAnalysisContainer and lives - caches included - across passes in
+/// the pipeline, so repeated value-pair and memory-behavior queries from
+/// different passes hit the caches. Any pass that invalidates instructions
+/// of the function drops the whole instance: the cache keys store raw
+/// SILValue and SILInstruction pointers, so retaining entries across a
+/// modification (e.g. with per-entry generation counters) would leave
+/// dangling keys behind deleted instructions. Wholesale invalidation is
+/// the price of pointer-keyed caching.
 class AliasAnalysis {
 public:
 
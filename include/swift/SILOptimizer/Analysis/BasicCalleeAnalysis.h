@@ -131,6 +131,15 @@ public:
 /// interface for retrieving a (possibly incomplete) CalleeList for
 /// any function application site (including those that are simple
 /// function_ref, thin_to_thick, or partial_apply callees).
+///
+/// The cache is derived purely from the module's vtables and witness
+/// tables - nothing is recorded per call site. That is what makes the
+/// analysis cheap to keep alive across function passes: rewriting a
+/// function's body cannot change which functions a method entry can
+/// dispatch to, so per-function invalidation is a no-op, and the cache
+/// is only rebuilt when the tables themselves change. The rebuild walks
+/// every table entry, so it scales with the number of methods in the
+/// module, not with the amount of SIL.
 class CalleeCache {
   using CalleesAndCanCallUnknown = llvm::PointerIntPair<CalleeList::Callees *, 1>;
   using CacheType = llvm::DenseMap<SILDeclRef, CalleesAndCanCallUnknown>;
@@ -221,6 +230,10 @@ public:
   }
 
   /// Notify the analysis about changed witness or vtables.
+  ///
+  /// This is the only event apart from a full invalidation that drops the
+  /// cache, since tables are the sole input to it. The subsequent rebuild
+  /// is lazy: nothing is recomputed until the next query.
   virtual void invalidateFunctionTables() override {
     Cache.reset();
   }
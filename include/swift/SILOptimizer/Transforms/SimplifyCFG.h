@@ -86,7 +86,8 @@ public:
   bool simplifyBlocks();
   bool canonicalizeSwitchEnums();
   bool simplifyThreadedTerminators();
-  bool dominatorBasedSimplifications(SILFunction &Fn, DominanceInfo *DT);
+  bool dominatorBasedSimplifications(SILFunction &Fn, DominanceInfo *DT,
+                                     bool &ChangedCFG);
   bool dominatorBasedSimplify(DominanceAnalysis *DA);
   bool threadEdge(const ThreadInfo &ti);
 
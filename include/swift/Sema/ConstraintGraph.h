@@ -91,6 +91,9 @@ private:
   /// as this type variable.
   ArrayRef<TypeVariableType *> getEquivalenceClassUnsafe() const;
 
+  /// Reset this node so it can be recycled for a new type variable.
+  void reset(TypeVariableType *typeVar);
+
   /// Add a constraint to the list of constraints.
   void addConstraint(Constraint *constraint);
 
@@ -433,6 +436,12 @@ private:
   /// The type variables in this graph, in stable order.
   std::vector<TypeVariableType *> TypeVariables;
 
+  /// Nodes released by removeNode, recycled by lookupNode. The solver adds
+  /// and removes type variables constantly while exploring, so recycling
+  /// nodes (and the heap storage of their adjacency sets) avoids allocator
+  /// churn and keeps node memory cache-warm.
+  std::vector<ConstraintGraphNode *> FreeNodes;
+
   /// Constraints that are "orphaned" because they contain no type variables.
   SmallVector<Constraint *, 4> OrphanedConstraints;
 
@@ -2169,6 +2169,21 @@ private:
   llvm::MapVector<std::pair<TypeBase *, TypeBase *>, ConversionRestrictionKind>
       ConstraintRestrictions;
 
+  /// The set of type matches between fully-resolved types that are known to
+  /// have failed, keyed by the type pair together with the match kind, flags
+  /// and the uniqued locator the match was attempted at. Since such matches
+  /// cannot depend on the state of any particular solver branch, remembering
+  /// the failures lets sibling branches that attempt the same concrete match
+  /// (common with heavily overloaded operators) fail immediately instead of
+  /// re-running the structural recursion in matchTypes(). The locator is part
+  /// of the key because some matches between concrete types are position
+  /// dependent - e.g. the implicit Double<->CGFloat conversion is allowed at
+  /// argument positions but not inside optional payloads. Only consulted when
+  /// fixes are disabled; see matchTypes() for the exact conditions.
+  llvm::DenseSet<std::pair<std::pair<TypeBase *, TypeBase *>,
+                           std::pair<unsigned, ConstraintLocator *>>>
+      FailedTypeMatches;
+
   /// The set of fixes applied to make the solution work.
   llvm::SmallSetVector<ConstraintFix *, 4> Fixes;
 
@@ -4497,6 +4512,12 @@ public:
                                            TypeMatchOptions flags,
                                            ConstraintLocatorBuilder locator);
 
+  /// The implementation of matchTypes(), which performs the actual
+  /// structural match once matchTypes() has consulted \c FailedTypeMatches.
+  TypeMatchResult matchTypesImpl(Type type1, Type type2, ConstraintKind kind,
+                                 TypeMatchOptions flags,
+                                 ConstraintLocatorBuilder locator);
+
 public: // FIXME: public due to statics in CSSimplify.cpp
   /// Attempt to match up types \c type1 and \c type2, which in effect
   /// is solving the given type constraint between these two types.
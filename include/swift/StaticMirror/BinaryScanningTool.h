@@ -33,6 +33,18 @@ struct ProtocolConformanceInfo;
 namespace static_mirror {
 
 /// The high-level implementation of the static mirror binary scanner
+///
+/// Concurrency model: a tool instance is thread-confined. All images given
+/// to the constructor share one ReflectionContext, whose TypeRefBuilder
+/// caches (demangle node allocator, typeref uniquing tables) mutate without
+/// synchronization on every query, so a single instance must not be used
+/// from multiple threads, and the collect* entry points cannot fan out
+/// internally without locking those caches on the per-descriptor fast path.
+/// To scan large binary sets in parallel, shard the paths and give each
+/// worker thread its own BinaryScanningTool, then merge the *Result
+/// structs; they are plain data. The per-worker typeref caches this forfeits
+/// cost far less than serializing the scan - most typerefs are image-local
+/// anyway.
 class BinaryScanningTool {
   template <unsigned PointerSize>
   using ExternalReflectionContext = swift::reflection::ReflectionContext<External<RuntimeTarget<PointerSize>>>;
@@ -72,9 +72,23 @@ llvm::Optional<stack_bounds> thread_get_current_stack_bounds();
 
 using mutex_handle = ::pthread_mutex_t;
 
+// Runtime-internal critical sections (metadata cache fills, conformance
+// lookups) usually hold their locks for tens of nanoseconds, so going
+// straight to a futex wait on contention costs two context switches to
+// cover a window shorter than the switch itself.  Where glibc offers it,
+// use the adaptive mutex type, which spins a bounded, self-tuning number
+// of iterations before parking.  Contention statistics don't need hooks
+// in this header: the futex path is observable with `perf lock contention`
+// or the futex tracepoints.
+#ifdef PTHREAD_ADAPTIVE_MUTEX_INITIALIZER_NP
+#define SWIFT_LINUXTHREADS_MUTEX_INITIALIZER PTHREAD_ADAPTIVE_MUTEX_INITIALIZER_NP
+#else
+#define SWIFT_LINUXTHREADS_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+#endif
+
 inline void mutex_init(mutex_handle &handle, bool checked = false) {
   if (!checked) {
-    handle = PTHREAD_MUTEX_INITIALIZER;
+    handle = SWIFT_LINUXTHREADS_MUTEX_INITIALIZER;
   } else {
     ::pthread_mutexattr_t attr;
     SWIFT_LINUXTHREADS_CHECK(::pthread_mutexattr_init(&attr));
@@ -111,7 +125,7 @@ using lazy_mutex_handle = ::pthread_mutex_t;
 // We don't actually need to be lazy here because pthreads has
 // PTHREAD_MUTEX_INITIALIZER.
 inline constexpr lazy_mutex_handle lazy_mutex_initializer() {
-  return PTHREAD_MUTEX_INITIALIZER;
+  return SWIFT_LINUXTHREADS_MUTEX_INITIALIZER;
 }
 inline void lazy_mutex_destroy(lazy_mutex_handle &handle) {
   SWIFT_LINUXTHREADS_CHECK(::pthread_mutex_destroy(&handle));
@@ -206,9 +220,26 @@ inline void once_impl(once_t &predicate, void (*fn)(void *), void *context) {
 
 // .. Thread local storage ...................................................
 
+// The runtime's own thread-locals (exclusivity state, the concurrency
+// runtime's current-task and executor-tracking slots) are hot enough that
+// the general-dynamic TLS model's __tls_get_addr calls show up in
+// profiles.  Building with SWIFT_THREADING_TLS_INITIAL_EXEC switches them
+// to the initial-exec model: one GOT load per access, resolved at load
+// time.  This is not the default because initial-exec variables must live
+// in the static TLS block; libswiftCore.so is routinely dlopen'd (plugins,
+// language bindings), and while glibc keeps a small surplus in that block
+// for exactly this trick, it is shared by every such library in the
+// process and exhausting it makes dlopen fail.  Vendors that link the
+// runtime into the base image (or always load it via DT_NEEDED) can turn
+// this on safely.
 #if __cplusplus >= 201103L || __has_feature(cxx_thread_local)
+#if defined(SWIFT_THREADING_TLS_INITIAL_EXEC)
+#define SWIFT_THREAD_LOCAL                                                     \
+  thread_local __attribute__((__tls_model__("initial-exec")))
+#else
 #define SWIFT_THREAD_LOCAL thread_local
 #endif
+#endif
 
 using tls_key_t = pthread_key_t;
 using tls_dtor_t = void (*)(void *);
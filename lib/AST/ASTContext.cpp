@@ -215,6 +215,12 @@ struct ASTContext::Implementation {
   DECL_CLASS *NAME##Decl = nullptr;
 #include "swift/AST/KnownSDKTypes.def"
 
+  /// Per operator name, the overload choices the constraint solver has
+  /// committed to in already-solved expressions anywhere in this context, in
+  /// the order they were first recorded.
+  llvm::DenseMap<Identifier, llvm::SmallVector<ValueDecl *, 4>>
+      SolvedOperatorOverloads;
+
   /// The declaration of '+' function for two RangeReplaceableCollection.
   FuncDecl *PlusFunctionOnRangeReplaceableCollection = nullptr;
 
@@ -408,6 +414,17 @@ struct ASTContext::Implementation {
 
   /// Structure that captures data that is segregated into different
   /// arenas.
+  ///
+  /// The uniquing tables below are already sharded along two axes: each
+  /// type kind has its own table, and each arena (permanent vs. constraint
+  /// solver) has its own copy of every table, so lookups for unrelated
+  /// kinds never touch the same bucket array. What they are *not* is
+  /// thread-safe: uniquing races with the bump-pointer allocator, with
+  /// lazy canonicalization, and with every evaluator request that mints
+  /// types. Wrapping these tables in striped locks would not make
+  /// concurrent type construction safe until those are addressed, so any
+  /// future multi-threaded Sema work needs to start with the allocator
+  /// and request evaluator, not here.
   struct Arena {
     static_assert(alignof(TypeBase) >= 8, "TypeBase not 8-byte aligned?");
     static_assert(alignof(TypeBase) > static_cast<unsigned>(
@@ -547,6 +564,10 @@ struct ASTContext::Implementation {
   /// The current constraint solver arena, if any.
   std::unique_ptr<ConstraintSolverArena> CurrentConstraintSolverArena;
 
+  /// The largest amount of memory ever held by a constraint solver arena,
+  /// recorded as each arena is torn down.
+  size_t MaxSolverMemory = 0;
+
   Arena &getArena(AllocationArena arena) {
     switch (arena) {
     case AllocationArena::Permanent:
@@ -598,7 +619,11 @@ ConstraintCheckerArenaRAII(ASTContext &self, llvm::BumpPtrAllocator &allocator)
 }
 
 ConstraintCheckerArenaRAII::~ConstraintCheckerArenaRAII() {
-  Self.getImpl().CurrentConstraintSolverArena.reset(
+  // Record the high water mark before this arena goes away.
+  auto &impl = Self.getImpl();
+  impl.MaxSolverMemory = std::max(impl.MaxSolverMemory,
+                                  Self.getSolverMemory());
+  impl.CurrentConstraintSolverArena.reset(
     (ASTContext::Implementation::ConstraintSolverArena *)Data);
 }
 
@@ -806,6 +831,23 @@ FuncDecl *ASTContext::getPlusFunctionOnRangeReplaceableCollection() const {
   return getImpl().PlusFunctionOnRangeReplaceableCollection;
 }
 
+void ASTContext::recordSolvedOperatorOverload(Identifier name,
+                                              ValueDecl *choice) {
+  auto &choices = getImpl().SolvedOperatorOverloads[name];
+  // Overload sets for a given operator are small; a linear scan beats any
+  // fancier deduplication here.
+  if (!llvm::is_contained(choices, choice))
+    choices.push_back(choice);
+}
+
+ArrayRef<ValueDecl *>
+ASTContext::getSolvedOperatorOverloads(Identifier name) const {
+  auto it = getImpl().SolvedOperatorOverloads.find(name);
+  if (it == getImpl().SolvedOperatorOverloads.end())
+    return {};
+  return it->second;
+}
+
 FuncDecl *ASTContext::getPlusFunctionOnString() const {
   if (getImpl().PlusFunctionOnString) {
     return getImpl().PlusFunctionOnString;
@@ -2942,15 +2984,21 @@ size_t ASTContext::getTotalMemory() const {
 
 size_t ASTContext::getSolverMemory() const {
   size_t Size = 0;
-  
+
   if (getImpl().CurrentConstraintSolverArena) {
     Size += getImpl().CurrentConstraintSolverArena->getTotalMemory();
     Size += getImpl().CurrentConstraintSolverArena->Allocator.getBytesAllocated();
   }
-  
+
   return Size;
 }
 
+size_t ASTContext::getSolverMemoryHighWater() const {
+  // A solver arena may still be live; fold it in so callers see the true
+  // high water mark at any point during the job.
+  return std::max(getImpl().MaxSolverMemory, getSolverMemory());
+}
+
 size_t ASTContext::Implementation::Arena::getTotalMemory() const {
   return sizeof(*this) +
     // TupleTypes ?
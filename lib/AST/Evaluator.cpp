@@ -58,6 +58,7 @@ void Evaluator::registerRequestFunctions(
 Evaluator::Evaluator(DiagnosticEngine &diags, const LangOptions &opts)
     : diags(diags),
       debugDumpCycles(opts.DebugDumpCycles),
+      cacheCapacity(opts.RequestCacheCapacity),
       recorder(opts.RecordRequestReferences) {}
 
 bool Evaluator::checkDependency(const ActiveRequest &request) {
@@ -827,10 +827,23 @@ Type BuildForwardingSubstitutions::operator()(SubstitutableType *type) const {
 }
 
 SubstitutionMap GenericEnvironment::getForwardingSubstitutionMap() const {
+  // For a primary environment, the forwarding substitutions are uniquely
+  // determined by the environment and requested constantly when emitting
+  // generic bodies, so cache them. Primary archetypes are allocated in the
+  // permanent arena, like the environment itself, so the cached map can
+  // never outlive its contents. Other environment kinds are short-lived
+  // and are not worth caching.
+  if (getKind() == Kind::Primary && !ForwardingSubMap.empty())
+    return ForwardingSubMap;
+
   auto genericSig = getGenericSignature();
-  return SubstitutionMap::get(genericSig,
-                              BuildForwardingSubstitutions(this),
-                              MakeAbstractConformanceForGenericType());
+  auto subMap = SubstitutionMap::get(genericSig,
+                                     BuildForwardingSubstitutions(this),
+                                     MakeAbstractConformanceForGenericType());
+  if (getKind() == Kind::Primary)
+    ForwardingSubMap = subMap;
+
+  return subMap;
 }
 
 std::pair<Type, ProtocolConformanceRef>
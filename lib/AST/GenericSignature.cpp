@@ -592,7 +592,14 @@ unsigned GenericParamKey::findIndexIn(
 }
 
 SubstitutionMap GenericSignatureImpl::getIdentitySubstitutionMap() const {
-  return SubstitutionMap::get(const_cast<GenericSignatureImpl *>(this),
+  // The identity substitution map is uniquely determined by the signature,
+  // and is requested again and again when forwarding substitutions, so
+  // cache it. The replacement types are the signature's own parameters, so
+  // the map always lives in the permanent arena, like the signature itself.
+  if (IdentitySubMap)
+    return SubstitutionMap::getFromOpaqueValue(IdentitySubMap);
+
+  auto subMap = SubstitutionMap::get(const_cast<GenericSignatureImpl *>(this),
     [](SubstitutableType *t) -> Type {
       auto param = cast<GenericTypeParamType>(t);
       if (!param->isParameterPack())
@@ -600,6 +607,9 @@ SubstitutionMap GenericSignatureImpl::getIdentitySubstitutionMap() const {
       return PackType::getSingletonPackExpansion(param);
     },
     MakeAbstractConformanceForGenericType());
+
+  IdentitySubMap = subMap.getOpaqueValue();
+  return subMap;
 }
 
 GenericTypeParamType *GenericSignatureImpl::getSugaredType(
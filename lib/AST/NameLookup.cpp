@@ -1483,6 +1483,15 @@ void NominalTypeDecl::addMemberToLookupTable(Decl *member) {
 // If the IDC list is later populated and/or an extension is added _after_
 // MemberLookupTable is constructed (and possibly has entries in it),
 // MemberLookupTable is incrementally reconstituted with new members.
+//
+// Note that for deserialized modules this in-memory table is only the
+// second-level cache: the .swiftmodule already contains an on-disk hash
+// table mapping member names to decl offsets (the DECL_MEMBER_NAMES and
+// DECL_MEMBERS records), which loadNamedMembers() consults through the
+// memory-mapped module buffer without deserializing any unrelated decls.
+// The MemberLookupTable entries built here for such contexts therefore
+// cover only the names that were actually queried in this process, not
+// the whole member list of every imported type.
 
 static void
 populateLookupTableEntryFromLazyIDCLoader(ASTContext &ctx,
@@ -140,6 +140,31 @@
 // requirement machine from the previously-computed requirement signatures
 // of those protocols.
 //
+// # Persistence of completed rewrite systems
+//
+// A natural extension of the above would be to serialize the completed
+// (confluent) rewrite system of each protocol connected component into the
+// .swiftmodule, so that downstream compilation jobs could skip completion
+// entirely for imported protocols. Several existing mechanisms already
+// capture most of this win within a single frontend job:
+//
+// - Requirement signatures are serialized, so imported protocols never
+//   re-run requirement minimization; only completion runs again.
+// - Completion only computes overlaps starting from the first local rule
+//   (see RewriteSystem::FirstLocalRule), so rules imported from an
+//   already-completed component machine are never overlapped against each
+//   other a second time.
+// - installRequirementMachine() re-uses the machine built during
+//   minimization for subsequent queries against the minimized signature.
+//
+// Persisting the completed rule set across frontend jobs would additionally
+// require encoding Symbol payloads -- protocol and associated type
+// references, layout constraints, and arbitrary concrete types with their
+// substitutions -- in the module format, together with a compatibility
+// story for rule set changes between compiler versions. That is a module
+// format feature rather than a change local to this directory, so it is
+// not attempted here.
+//
 //===----------------------------------------------------------------------===//
 
 #include "swift/AST/Decl.h"
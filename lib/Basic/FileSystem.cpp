@@ -292,3 +292,11 @@ swift::vfs::getFileOrSTDIN(llvm::vfs::FileSystem &FS,
   }
   return inputFileOrErr;
 }
+
+llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>>
+swift::vfs::getMemoryMappedFile(llvm::vfs::FileSystem &FS,
+                                const llvm::Twine &Filename,
+                                bool IsVolatile) {
+  return FS.getBufferForFile(Filename, /*FileSize*/ -1,
+                             /*RequiresNullTerminator*/ false, IsVolatile);
+}
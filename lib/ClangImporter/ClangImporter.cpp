@@ -501,6 +501,14 @@ importer::getNormalInvocationArguments(
     invocationArgStrs.insert(invocationArgStrs.end(), {"-fPIC"});
 
   // Enable modules.
+  //
+  // In this implicit mode, Clang discovers and compiles missing PCMs
+  // recursively while parsing: a dependency is only found partway through
+  // building its parent, so the chain is inherently serial and cannot be
+  // fanned out onto a thread pool from here. Builds that want cold PCM
+  // compilation to overlap should use explicit module builds, where the
+  // dependency scanner surfaces the whole PCM graph up front and the
+  // driver schedules each -emit-pcm job independently.
   invocationArgStrs.insert(invocationArgStrs.end(), {
       "-fmodules",
       "-Xclang", "-fmodule-feature", "-Xclang", "swift"
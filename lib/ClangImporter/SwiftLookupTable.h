@@ -294,6 +294,15 @@ const uint16_t SWIFT_LOOKUP_TABLE_VERSION_MINOR = 18; // Unsafe C++ method renam
 /// entities. This lookup table provides efficient access to the C
 /// entities based on their Swift names, and is used by the Clang
 /// importer to satisfy the Swift compiler's queries.
+///
+/// When a table comes from a serialized Clang module, it is read through
+/// a \c SwiftLookupTableReader over on-disk chained hash tables stored in
+/// the module file. Nothing is deserialized up front: each lookup probes
+/// the on-disk table through the memory-mapped module buffer, paging in
+/// only the buckets it touches, and caches the decoded entries in this
+/// table for subsequent queries. Whole-table enumeration (and therefore
+/// full deserialization) only happens for operations that inherently need
+/// every name, such as top-level completion or dumping.
 class SwiftLookupTable {
 public:
   /// The kind of context in which a name occurs.
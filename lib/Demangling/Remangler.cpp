@@ -14,6 +14,18 @@
 //  tree back into a mangled string.  This is useful for tools which
 //  want to extract subtrees from mangled strings.
 //
+//  There is intentionally no streaming (string-to-string) variant for the
+//  "simple rewrite" cases.  Substitutions make mangled strings globally
+//  stateful: every word and every mangled entity may be abbreviated by an
+//  index into the sequence of candidates seen so far, so inserting or
+//  replacing even one component shifts the numbering of every later
+//  substitution.  Recomputing that numbering requires exactly the
+//  information the parse tree holds, at which point a "streaming"
+//  rewriter is this file with a worse interface.  Callers that only need
+//  to *test* properties of a symbol (rather than rewrite it) should use
+//  the string-level predicates in Demangle.h (isMangledName,
+//  isSwiftSymbol and friends), which avoid tree construction entirely.
+//
 //===----------------------------------------------------------------------===//
 
 #include "DemanglerAssert.h"
@@ -36,6 +36,7 @@
 #include "swift/Frontend/ModuleInterfaceLoader.h"
 #include "swift/Strings.h"
 #include "clang/Basic/Module.h"
+#include "llvm/ADT/BitVector.h"
 #include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/SetOperations.h"
 #include "llvm/ADT/StringMap.h"
@@ -227,25 +228,44 @@ static std::unordered_map<ModuleDependencyID,
 computeTransitiveClosureOfExplicitDependencies(
     const std::vector<ModuleDependencyID> &topologicallySortedModuleList,
     const ModuleDependenciesCache &cache) {
-  // The usage of an ordered ::set is important to ensure the
-  // dependencies are listed in a deterministic order.
-  std::unordered_map<ModuleDependencyID, std::set<ModuleDependencyID>>
-      result;
-  for (const auto &modID : topologicallySortedModuleList)
-    result[modID] = {modID};
+  // Assign each module a dense index so that per-module reachability can
+  // be tracked in bit vectors. The whole-word unions below replace the
+  // element-wise ordered-set unions this computation used to perform,
+  // which dominated scan time on graphs with over a thousand modules.
+  const unsigned numModules = topologicallySortedModuleList.size();
+  std::unordered_map<ModuleDependencyID, unsigned> moduleIndices;
+  moduleIndices.reserve(numModules);
+  for (unsigned index = 0; index != numModules; ++index)
+    moduleIndices[topologicallySortedModuleList[index]] = index;
+
+  std::vector<llvm::BitVector> reachability(numModules,
+                                            llvm::BitVector(numModules));
+  for (unsigned index = 0; index != numModules; ++index)
+    reachability[index].set(index);
 
   // Traverse the set of modules in reverse topological order, assimilating
   // transitive closures
   for (auto it = topologicallySortedModuleList.rbegin(),
             end = topologicallySortedModuleList.rend();
        it != end; ++it) {
-    const auto &modID = *it;
-    auto &modReachableSet = result[modID];
-    for (const auto &succID : getDependencies(modID, cache)) {
-      const auto &succReachableSet = result[succID];
-      llvm::set_union(modReachableSet, succReachableSet);
+    auto &modReachableSet = reachability[moduleIndices[*it]];
+    for (const auto &succID : getDependencies(*it, cache)) {
+      auto succIndex = moduleIndices.find(succID);
+      assert(succIndex != moduleIndices.end() &&
+             "Successor absent from the topologically-sorted module list");
+      modReachableSet |= reachability[succIndex->second];
     }
   }
+
+  // Materialize the bit vectors as ordered ::sets to ensure the
+  // dependencies are listed in a deterministic order.
+  std::unordered_map<ModuleDependencyID, std::set<ModuleDependencyID>>
+      result;
+  for (unsigned index = 0; index != numModules; ++index) {
+    auto &modReachableSet = result[topologicallySortedModuleList[index]];
+    for (auto reachableIndex : reachability[index].set_bits())
+      modReachableSet.insert(topologicallySortedModuleList[reachableIndex]);
+  }
   return result;
 }
 
@@ -1176,6 +1176,14 @@ namespace driver {
     /// Create \c NumberOfParallelCommands batches and assign each job to a
     /// batch either filling each partition in order or, if seeded with a
     /// nonzero value, pseudo-randomly (but deterministically and nearly-evenly).
+    ///
+    /// Partitioning is static: each batch becomes one frontend process whose
+    /// input list is fixed at exec time, so a long-running batch cannot be
+    /// split and redistributed once workers go idle - stealing would mean
+    /// killing the process and discarding the type-checking work it has
+    /// already done. The knobs that exist for tail-latency problems are
+    /// -driver-batch-count (more, smaller batches trade per-process overhead
+    /// for better load balance) and -driver-batch-size-limit.
     void partitionIntoBatches(std::vector<const Job *> Batchable,
                               BatchPartition &Partition) {
       if (Comp.getShowJobLifecycle()) {
@@ -1870,6 +1878,23 @@ static bool writeAllSourcesFile(DiagnosticEngine &diags, StringRef path,
   return true;
 }
 
+// Every frontend job below runs as a subprocess, even though performFrontend
+// is an ordinary library entry point linked into this binary (driver.cpp
+// dispatches "-frontend" to it directly). Running frontend invocations as
+// in-process tasks on a worker pool has come up as a way to shed the exec,
+// dynamic-linking, and option-parsing cost of tiny incremental jobs, but a
+// CompilerInstance is not the only state a job owns: jobs mutate the global
+// environment (see the setenv loop in performSingleCommand), LLVM's one-time
+// initialization, command-line option registry, and fatal-error/signal
+// handlers are per-process, ASTContext arenas are only reclaimed at process
+// exit so a long driver run would accumulate every job's memory, and
+// parseable output reports real PIDs that build systems use to attribute
+// crashes. Losing that crash isolation is the expensive part: one
+// ill-behaved type-check would take every in-flight job with it. The fixed
+// cost is instead amortized by packing many primary files into a single
+// frontend invocation (batch mode, above) and by exec'ing in place when
+// there is exactly one job (below). A worker-pool scheduler is better built
+// in the new swift-driver, which this binary already forwards to.
 Compilation::Result Compilation::performJobs(std::unique_ptr<TaskQueue> &&TQ) {
   if (AllSourceFilesPath)
     if (!writeAllSourcesFile(Diags, AllSourceFilesPath, getInputFiles()))
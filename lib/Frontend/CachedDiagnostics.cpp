@@ -12,6 +12,16 @@
 //
 //  This file implements the CachedDiagnosticsProcessor class.
 //
+//  Replay deliberately re-materializes SourceLocs in a private
+//  SourceManager instead of caching pre-rendered text. Diagnostics are not
+//  consumed as text: serialized-diagnostics files, SourceKit, and editor
+//  integrations receive structured locations, ranges, and fix-its through
+//  DiagnosticConsumer, and several consumers read adjacent source snippets
+//  while formatting. A text-only replay would be faster but could serve
+//  only the terminal printer. The buffer loads on the replay path are
+//  limited to files a diagnostic actually points into, not the whole
+//  input set.
+//
 //===----------------------------------------------------------------------===//
 
 #include "swift/Frontend/CachedDiagnostics.h"
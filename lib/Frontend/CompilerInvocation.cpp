@@ -671,6 +671,17 @@ static bool ParseLangArgs(LangOptions &Opts, ArgList &Args,
     }
   }
 
+  if (auto A = Args.getLastArg(OPT_request_cache_capacity)) {
+    unsigned capacity;
+    if (StringRef(A->getValue()).getAsInteger(10, capacity)) {
+      Diags.diagnose(SourceLoc(), diag::error_invalid_arg_value,
+                     A->getAsString(Args), A->getValue());
+      HadError = true;
+    } else {
+      Opts.RequestCacheCapacity = capacity;
+    }
+  }
+
   if (auto A = Args.getLastArg(OPT_enable_target_os_checking,
                                OPT_disable_target_os_checking)) {
     Opts.EnableTargetOSChecking
@@ -2429,6 +2440,7 @@ static bool ParseIRGenArgs(IRGenOptions &Opts, ArgList &Args,
 
   if (Args.hasArg(OPT_use_jit)) {
     Opts.UseJIT = true;
+    Opts.UseJITLazy = Args.hasArg(OPT_enable_lazy_jit);
     if (const Arg *A = Args.getLastArg(OPT_dump_jit)) {
       llvm::Optional<swift::JITDebugArtifact> artifact =
           llvm::StringSwitch<llvm::Optional<swift::JITDebugArtifact>>(A->getValue())
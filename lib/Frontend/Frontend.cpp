@@ -52,6 +52,7 @@
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/Process.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/VirtualOutputBackends.h"
 #include <llvm/ADT/StringExtras.h>
 
@@ -429,6 +430,14 @@ bool CompilerInstance::setupCASIfNeeded(ArrayRef<const char *> Args) {
   if (!Opts.EnableCAS)
     return false;
 
+  // This is the only place the frontend commits to a concrete CAS
+  // implementation; everything downstream talks to the abstract
+  // llvm::cas::ObjectStore and ActionCache interfaces. Sharing a cache
+  // across machines (e.g. a remote content-addressed store with local
+  // write-through) is therefore a matter of constructing a different
+  // implementation here, and the transport belongs behind those LLVM
+  // interfaces - the frontend should never grow protocol or fleet
+  // topology knowledge of its own.
   auto MaybeCache = llvm::cas::createOnDiskUnifiedCASDatabases(Opts.CASPath);
   if (!MaybeCache) {
     Diagnostics.diagnose(SourceLoc(), diag::error_create_cas, Opts.CASPath,
@@ -954,11 +963,13 @@ CompilerInstance::openModuleSourceInfo(const InputFile &input) {
   llvm::sys::path::remove_filename(pathWithProjectDir);
   llvm::sys::path::append(pathWithProjectDir, "Project");
   llvm::sys::path::append(pathWithProjectDir, fileName);
-  if (auto sourceInfoFileOrErr = swift::vfs::getFileOrSTDIN(getFileSystem(),
-                                                            pathWithProjectDir))
+  // Serialized source info is read positionally, so map it rather than
+  // copying it into anonymous memory.
+  if (auto sourceInfoFileOrErr = swift::vfs::getMemoryMappedFile(
+          getFileSystem(), pathWithProjectDir))
     return std::move(*sourceInfoFileOrErr);
-  if (auto sourceInfoFileOrErr = swift::vfs::getFileOrSTDIN(getFileSystem(),
-                                                            pathWithoutProjectDir))
+  if (auto sourceInfoFileOrErr = swift::vfs::getMemoryMappedFile(
+          getFileSystem(), pathWithoutProjectDir))
     return std::move(*sourceInfoFileOrErr);
   return None;
 }
@@ -970,8 +981,10 @@ CompilerInstance::openModuleDoc(const InputFile &input) {
       moduleDocFilePath,
       file_types::getExtension(file_types::TY_SwiftModuleDocFile));
   using FileOrError = llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>>;
+  // Serialized module docs are read positionally, so map them rather than
+  // copying them into anonymous memory.
   FileOrError moduleDocFileOrErr =
-      swift::vfs::getFileOrSTDIN(getFileSystem(), moduleDocFilePath);
+      swift::vfs::getMemoryMappedFile(getFileSystem(), moduleDocFilePath);
   if (moduleDocFileOrErr)
     return std::move(*moduleDocFileOrErr);
 
@@ -1348,6 +1361,39 @@ void CompilerInstance::setMainModule(ModuleDecl *newMod) {
   Context->MainModule = newMod;
 }
 
+/// Lex every source file of \p mainModule on a thread pool.
+///
+/// This discards the tokens; the point is to overlap file I/O, page faults
+/// and token scanning across cores before the serial per-file parse below.
+/// Each worker uses a standalone Lexer with no diagnostics, so nothing
+/// shared with the ASTContext is touched concurrently.
+static void lexSourceFilesInParallel(CompilerInstance &CI,
+                                     ModuleDecl *mainModule) {
+  SmallVector<unsigned, 16> bufferIDs;
+  for (auto *file : mainModule->getFiles()) {
+    if (auto *SF = dyn_cast<SourceFile>(file))
+      if (auto bufferID = SF->getBufferID())
+        bufferIDs.push_back(*bufferID);
+  }
+  if (bufferIDs.size() < 2)
+    return;
+
+  auto &langOpts = CI.getASTContext().LangOpts;
+  auto &sourceMgr = CI.getSourceMgr();
+  llvm::ThreadPool pool(llvm::hardware_concurrency());
+  for (unsigned bufferID : bufferIDs) {
+    pool.async([&langOpts, &sourceMgr, bufferID] {
+      Lexer lexer(langOpts, sourceMgr, bufferID, /*Diags=*/nullptr,
+                  LexerMode::Swift, HashbangMode::Allowed);
+      Token tok;
+      do {
+        lexer.lex(tok);
+      } while (tok.isNot(tok::eof));
+    });
+  }
+  pool.wait();
+}
+
 bool CompilerInstance::performParseAndResolveImportsOnly() {
   FrontendStatsTracer tracer(getStatsReporter(), "parse-and-resolve-imports");
 
@@ -1374,6 +1420,9 @@ bool CompilerInstance::performParseAndResolveImportsOnly() {
     }
   }
 
+  if (Invocation.getFrontendOptions().ParallelParseFiles)
+    lexSourceFilesInParallel(*this, mainModule);
+
   // Resolve imports for all the source files.
   for (auto *file : mainModule->getFiles()) {
     if (auto *SF = dyn_cast<SourceFile>(file))
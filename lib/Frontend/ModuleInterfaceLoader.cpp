@@ -468,6 +468,16 @@ public:
 
   // Checks that a dependency read from the cached module is up to date compared
   // to the interface file it represents.
+  //
+  // Which of the two checks below applies is decided when the cached module
+  // is *built*: by default dependencies are recorded with their size and
+  // modification time, which is cheap to validate but reports false
+  // positives in environments that do not preserve timestamps (build farms
+  // resetting checkouts, for instance). Building with
+  // -serialize-module-interface-dependency-hashes records a content hash
+  // instead, so byte-identical dependencies never trigger a rebuild no
+  // matter what their timestamps say, at the cost of reading each
+  // dependency to validate it.
   DependencyStatus checkDependency(StringRef modulePath,
                                    const FileDependency &dep,
                                    StringRef fullPath) {
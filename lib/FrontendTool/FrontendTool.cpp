@@ -167,6 +167,15 @@ static bool printAsClangHeaderIfNeeded(llvm::vfs::OutputBackend &outputBackend,
     clang::HeaderSearch &clangHeaderSearchInfo) {
   if (outputPath.empty())
     return false;
+  // Reprinting the header on every build is fine for downstream
+  // invalidation purposes: withOutputPath configures the output as
+  // OnlyIfDifferent, so when the printed bytes match the existing file it
+  // is left untouched and its mtime doesn't move, which is what stops
+  // rebuild cascades through mixed-language targets. Skipping the printing
+  // work itself via per-decl fingerprints wouldn't be sound with
+  // Fingerprint as it exists - it hashes a decl's source tokens, while the
+  // printed form also depends on type lowering, imports, and the interop
+  // version macros.
   return withOutputPath(
       M->getDiags(), outputBackend, outputPath, [&](raw_ostream &out) -> bool {
         return printAsClangHeader(out, M, bridgingHeader, frontendOpts,
@@ -309,6 +318,8 @@ static void countASTStats(UnifiedStatsReporter &Stats,
 
   auto const &AST = Instance.getASTContext();
   C.NumLoadedModules = AST.getNumLoadedModules();
+  C.NumASTContextBytesTotal = AST.getTotalMemory();
+  C.MaxSolverMemoryUsage = AST.getSolverMemoryHighWater();
 
   if (auto *D = Instance.getDependencyTracker()) {
     C.NumDependencies = D->getDependencies().size();
@@ -359,6 +370,7 @@ static void countStatsPostSILGen(UnifiedStatsReporter &Stats,
   C.NumSILGenWitnessTables += Module.getWitnessTableList().size();
   C.NumSILGenDefaultWitnessTables += Module.getDefaultWitnessTableList().size();
   C.NumSILGenGlobalVariables += Module.getSILGlobalList().size();
+  C.NumSILModuleBytesAllocated = Module.getBytesAllocated();
 }
 
 static bool precompileBridgingHeader(const CompilerInstance &Instance) {
@@ -1717,6 +1729,15 @@ static bool performCompileStepsPostSILGen(CompilerInstance &Instance,
     // Infer if this is an emit-module job part of an incremental build,
     // vs a partial emit-module job (with primary files) or other kinds.
     // We may want to rely on a flag instead to differentiate them.
+    //
+    // Note that this job is already the mechanism that shortens the
+    // critical path for dependent targets: it skips non-inlinable function
+    // bodies, so dependents wait on a cheap declaration-only pass rather
+    // than on full compilation. Going further and letting dependents read
+    // a module while it is being written is not possible with this format:
+    // the lookup tables and offset arrays are emitted after all records
+    // and the file only becomes valid atomically at the end, so a
+    // "partial module" is indistinguishable from a truncated one.
     const bool isEmitModuleSeparately =
         Action == FrontendOptions::ActionType::EmitModuleOnly &&
         MSF.is<ModuleDecl *>() &&
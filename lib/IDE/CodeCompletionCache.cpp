@@ -103,6 +103,17 @@ CodeCompletionCache::~CodeCompletionCache() {}
 ///
 /// This should be incremented any time we commit a change to the format of the
 /// cached results. This isn't expected to change very often.
+///
+/// The format is deliberately deserialize-on-read rather than usable in
+/// place: completion results are pointer-rich (CodeCompletionString chunk
+/// arrays, the USRBasedType supertype graph) and interned into per-value
+/// allocators, so an in-place representation would freeze those in-memory
+/// layouts into the format — note how often this version number has moved.
+/// The expensive part of a cold start, regenerating stdlib/SDK results, is
+/// already avoided: these files persist in the cache directory across
+/// sourcekitd restarts, keyed by module mtime, and loading one is a single
+/// (mmap-backed) file read plus this linear decode. The mtime key is also
+/// why the files are only valid on the machine that wrote them.
 static constexpr uint32_t onDiskCompletionCacheVersion =
     11; // Added macro roles
 
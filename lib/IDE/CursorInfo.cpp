@@ -9,6 +9,20 @@
 // See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
 //
 //===----------------------------------------------------------------------===//
+//
+//  Cursor info is resolved on demand, per position.  A warm-ahead mode that
+//  resolves a whole visible range up front has been considered and doesn't
+//  pay off at this layer: the expensive state — the type-checked AST — is
+//  already kept warm across requests by SourceKit's AST manager, and the
+//  per-position work done here (solving for the code-completion-style
+//  callback below, USR generation, doc comment lookup) is invalidated by
+//  the very keystrokes that would trigger re-warming.  A range-based
+//  request would mostly compute results the user never hovers and throw
+//  them away on the next edit.  If an editor wants speculative hovers, it
+//  can issue ordinary cursor-info requests for positions it predicts;
+//  they will share the cached AST like any other request.
+//
+//===----------------------------------------------------------------------===//
 
 #include "swift/IDE/CursorInfo.h"
 #include "ExprContextAnalysis.h"
@@ -1189,6 +1189,16 @@ private:
 ///
 /// It only walks into nodes whose source range overlaps, or immediately
 /// precedes the target indent location.
+///
+/// That pruning is what keeps repeated auto-indent queries tolerable:
+/// the walk visits the spine of contexts enclosing the target, not the
+/// whole file, so there is no per-line checkpoint cache to maintain or
+/// invalidate here.  Indentation is also not a function of a linear
+/// brace/alignment stack that such checkpoints could capture — exact
+/// alignment contexts, trailing closures, and multi-line strings all
+/// draw on the enclosing AST nodes directly.  When newline-indent lags
+/// on large files, the time is going into reparsing the edited file to
+/// get that AST, which is owned by the layers above this one.
 class FormatWalker : public ASTWalker {
   SourceFile &SF;
   SourceManager &SM;
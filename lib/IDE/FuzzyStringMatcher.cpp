@@ -57,8 +57,29 @@ bool FuzzyStringMatcher::matchesCandidate(StringRef candidate) const {
   if (patternLength > candidateLength)
     return false;
 
-  // Do all of the pattern characters match the candidate in order?
-  unsigned pidx = 0, cidx = 0;
+  if (patternLength == 0)
+    return true;
+
+  // When filtering a large result set most candidates don't contain the
+  // first pattern character at all, so dispose of them with a memchr-based
+  // scan (via StringRef::find) before falling into the per-character loop.
+  unsigned pidx = 1, cidx = 0;
+  {
+    char lower = lowercasePattern[0];
+    char upper = toUppercase(lower);
+    size_t first = candidate.find(lower);
+    if (upper != lower) {
+      size_t limit = first == StringRef::npos ? candidateLength : first;
+      size_t firstUpper = candidate.take_front(limit).find(upper);
+      if (firstUpper != StringRef::npos)
+        first = firstUpper;
+    }
+    if (first == StringRef::npos || candidateLength - first < patternLength)
+      return false;
+    cidx = first + 1;
+  }
+
+  // Do all of the remaining pattern characters match the candidate in order?
   while (pidx < patternLength && cidx < candidateLength) {
     char c = candidate[cidx];
     char p = lowercasePattern[pidx];
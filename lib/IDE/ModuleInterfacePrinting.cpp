@@ -526,6 +526,18 @@ static void printCrossImportOverlays(ModuleDecl *Declaring, ASTContext &Ctx,
   }
 }
 
+// Printing happens afresh per request rather than from an on-disk cache.
+// A fingerprint-keyed cache sounds straightforward but the key is not: the
+// output depends on the target module's transitive dependencies (synthesized
+// extensions and submodule filtering pull in decls from other modules), on
+// the full PrintOptions state, and on the compiler's own version, so a safe
+// key amounts to a hash of most of the compilation. The printed text is
+// also only half of the product — clients need the decl/USR ↔ offset
+// annotations the ASTPrinter emits as it goes, which reference live decls
+// and would need their own serialized form. Callers that revisit
+// interfaces repeatedly (generated-interface editors) cache the finished
+// document above this layer, where the annotations are already reduced to
+// plain offsets.
 void swift::ide::printModuleInterface(
        ModuleDecl *TargetMod,
        ArrayRef<StringRef> GroupNames,
@@ -115,6 +115,16 @@ matchColorLiteralArg(ArrayRef<Token> Tokens) {
   return Located<unsigned>(NUM_TOKENS, EndToken.getLoc().getAdvancedLoc(EndToken.getLength()));
 }
 
+// The model is rebuilt from the full token stream and a full AST walk per
+// request rather than patched incrementally around an edit range.  Token
+// classification here is not line-local: string interpolations, multi-line
+// strings, attributes, and `#if` blocks let a one-character edit change the
+// classification of arbitrarily distant text, and the structural nodes
+// produced in walk() come from an AST that is itself rebuilt wholesale.
+// Reconciling a patched map against a fresh AST would need exactly the
+// reparse bounds a full rebuild already computes.  Clients that only need
+// coloring for the visible range should slice the resulting map; building
+// it is dominated by the AST, which is shared and cached above this layer.
 SyntaxModelContext::SyntaxModelContext(SourceFile &SrcFile)
   : Impl(*new Implementation(SrcFile)) {
   const bool IsPlayground = Impl.LangOpts.Playground;
@@ -36,7 +36,9 @@
 #include "swift/SymbolGraphGen/SymbolGraphOptions.h"
 #include "clang/AST/ASTContext.h"
 #include "llvm/ADT/Hashing.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include <algorithm>
 
 using namespace swift;
 using namespace ide;
@@ -187,17 +189,37 @@ bool IDEInspectionInstance::performCachedOperationIfPossible(
   llvm::PrettyStackTraceString trace(
       "While performing cached IDE inspection if possible");
 
-  // Check the invalidation first. Otherwise, in case no 'CacheCI' exists yet,
-  // the flag will remain 'true' even after 'CachedCI' is populated.
-  if (CachedCIShouldBeInvalidated.exchange(false))
+  // Check the invalidation first. Otherwise, in case no instance has been
+  // cached yet, the flag would remain 'true' even after one is populated.
+  if (CachedCIShouldBeInvalidated.exchange(false)) {
+    CachedInstances.clear();
     return false;
-  if (!CachedCI)
-    return false;
-  if (CachedReuseCount >= Opts.MaxASTReuseCount)
+  }
+
+  // Find a warm instance for the same invocation whose inspection file is the
+  // one this request targets. Each cached entry covers a different file, so
+  // requests alternating between a small number of files can each reuse
+  // their own AST.
+  auto bufferName = ideInspectionTargetBuffer->getBufferIdentifier();
+  auto entryIt =
+      llvm::find_if(CachedInstances, [&](const CachedInstance &entry) {
+        if (entry.ArgHash != ArgsHash)
+          return false;
+        auto *cachedSF = entry.CI->getIDEInspectionFile();
+        assert(cachedSF->getBufferID());
+        return entry.CI->getSourceMgr().getIdentifierForBuffer(
+                   *cachedSF->getBufferID()) == bufferName;
+      });
+  if (entryIt == CachedInstances.end())
     return false;
-  if (CachedArgHash != ArgsHash)
+  if (entryIt->ReuseCount >= Opts.MaxASTReuseCount)
     return false;
 
+  // Mark the entry most recently used.
+  std::rotate(entryIt, std::next(entryIt), CachedInstances.end());
+  auto &entry = CachedInstances.back();
+  std::shared_ptr<CompilerInstance> CachedCI = entry.CI;
+
   auto *oldSF = CachedCI->getIDEInspectionFile();
   assert(oldSF->getBufferID());
 
@@ -206,11 +228,8 @@ bool IDEInspectionInstance::performCachedOperationIfPossible(
   auto &oldInfo = oldState->getIDEInspectionDelayedDeclState();
 
   auto &SM = CachedCI->getSourceMgr();
-  auto bufferName = ideInspectionTargetBuffer->getBufferIdentifier();
-  if (SM.getIdentifierForBuffer(*oldSF->getBufferID()) != bufferName)
-    return false;
 
-  if (shouldCheckDependencies()) {
+  if (shouldCheckDependencies(entry)) {
     // The passed in FileSystem does not have any overlays resolved. Make sure
     // to do so before checking dependencies (otherwise we might decide we need
     // to run the slow path due to a missing/different file).
@@ -223,9 +242,9 @@ bool IDEInspectionInstance::performCachedOperationIfPossible(
 
     if (areAnyDependentFilesInvalidated(
             *CachedCI, *FileSystem, *oldSF->getBufferID(),
-            DependencyCheckedTimestamp, InMemoryDependencyHash))
+            entry.DependencyCheckedTimestamp, entry.InMemoryDependencyHash))
       return false;
-    DependencyCheckedTimestamp = std::chrono::system_clock::now();
+    entry.DependencyCheckedTimestamp = std::chrono::system_clock::now();
   }
 
   // Parse the new buffer into temporary SourceFile.
@@ -438,7 +457,7 @@ bool IDEInspectionInstance::performCachedOperationIfPossible(
       CachedCI->removeDiagnosticConsumer(DiagC);
   }
 
-  CachedReuseCount += 1;
+  entry.ReuseCount += 1;
 
   return true;
 }
@@ -520,23 +539,40 @@ void IDEInspectionInstance::performNewOperation(
 
 void IDEInspectionInstance::cacheCompilerInstance(
     std::shared_ptr<CompilerInstance> CI, llvm::hash_code ArgsHash) {
-  CachedCI = std::move(CI);
-  CachedArgHash = ArgsHash;
-  auto now = std::chrono::system_clock::now();
-  DependencyCheckedTimestamp = now;
-  CachedReuseCount = 0;
-  InMemoryDependencyHash.clear();
+  CachedInstance entry;
+  entry.CI = std::move(CI);
+  entry.ArgHash = ArgsHash;
+  entry.DependencyCheckedTimestamp = std::chrono::system_clock::now();
   cacheDependencyHashIfNeeded(
-      *CachedCI,
-      CachedCI->getASTContext().SourceMgr.getIDEInspectionTargetBufferID(),
-      InMemoryDependencyHash);
+      *entry.CI,
+      entry.CI->getASTContext().SourceMgr.getIDEInspectionTargetBufferID(),
+      entry.InMemoryDependencyHash);
+
+  // If there already is an entry for the same invocation and inspection
+  // file, it has just been superseded; drop it.
+  auto *newSF = entry.CI->getIDEInspectionFile();
+  auto bufferName =
+      entry.CI->getSourceMgr().getIdentifierForBuffer(*newSF->getBufferID());
+  llvm::erase_if(CachedInstances, [&](const CachedInstance &existing) {
+    if (existing.ArgHash != entry.ArgHash)
+      return false;
+    auto *existingSF = existing.CI->getIDEInspectionFile();
+    return existing.CI->getSourceMgr().getIdentifierForBuffer(
+               *existingSF->getBufferID()) == bufferName;
+  });
+
+  CachedInstances.push_back(std::move(entry));
+
+  // Evict the least recently used entries beyond the configured limit.
+  while (CachedInstances.size() > Opts.MaxCachedCompilerInstances)
+    CachedInstances.erase(CachedInstances.begin());
 }
 
-bool IDEInspectionInstance::shouldCheckDependencies() const {
-  assert(CachedCI);
+bool IDEInspectionInstance::shouldCheckDependencies(
+    const CachedInstance &Entry) const {
   using namespace std::chrono;
   auto now = system_clock::now();
-  auto threshold = DependencyCheckedTimestamp +
+  auto threshold = Entry.DependencyCheckedTimestamp +
                    seconds(Opts.DependencyCheckIntervalSecond);
   return threshold <= now;
 }
@@ -103,6 +103,15 @@ AsyncContextLayout irgen::getAsyncContextLayout(
   // FIXME: everything about this type is way more complicated than it
   // needs to be now that we no longer pass and return things in memory
   // in the async context and therefore the layout is totally static.
+  //
+  // Note that IRGen only lays out this fixed ABI header (parent pointer and
+  // resume function). The bulk of an async frame - values that must survive
+  // a suspension - is spilled by LLVM's coroutine splitting, which computes
+  // per-suspend liveness and only reserves frame slots for values actually
+  // live across some suspension point. Likewise, resume is already chained
+  // through tail calls via the llvm.coro.suspend.async lowering. Oversized
+  // frames therefore come from values genuinely (if sometimes surprisingly)
+  // live across an await, not from a declaration-order layout down here.
 
   SmallVector<const TypeInfo *, 4> typeInfos;
   SmallVector<SILType, 4> valTypes;
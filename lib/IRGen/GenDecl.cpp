@@ -6125,12 +6125,17 @@ void IRGenModule::setColocateMetadataSection(llvm::Function *f) {
   case llvm::Triple::MachO:
     f->setSection("__TEXT, __textg_swiftm, regular, pure_instructions");
     break;
+  case llvm::Triple::ELF:
+    // Linkers group same-named .text.* input sections together within the
+    // .text output section, which gives us the same locality benefit as the
+    // dedicated Mach-O segment.
+    f->setSection(".text.swiftm");
+    break;
   case llvm::Triple::DXContainer:
   case llvm::Triple::GOFF:
   case llvm::Triple::SPIRV:
   case llvm::Triple::UnknownObjectFormat:
   case llvm::Triple::Wasm:
-  case llvm::Triple::ELF:
   case llvm::Triple::XCOFF:
   case llvm::Triple::COFF:
     break;
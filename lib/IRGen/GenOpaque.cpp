@@ -823,6 +823,19 @@ void irgen::emitDestroyArrayCall(IRGenFunction &IGF,
 
 /// Emit a trampoline to call the getEnumTagSinglePayload witness. API:
 /// UINT_TYPE (const T* enum, UINT_TYPE emptyCases, M *self)
+///
+/// These trampolines only exist for layouts that are dynamic at this point
+/// in compilation: when the payload layout is statically known, GenEnum
+/// emits the tag check inline and no runtime call is made at all. That is
+/// why adding size-specialized runtime entry points (a get/store pair for
+/// 1/2/4/8-byte payloads) would not move profiles: any caller that could
+/// select the right specialized symbol knows the size statically, and such
+/// callers already bypass the runtime; the callers that remain cannot pick
+/// a size at compile time by definition. Inside the runtime the per-size
+/// dispatch is already a switch in EnumImpl.h, shared by every witness.
+/// When Optional tag traffic through these trampolines is hot, the cure is
+/// getting the generic context specialized (or CMO'd) so the layout
+/// becomes static, not widening the runtime interface.
 static llvm::Constant *
 getGetEnumTagSinglePayloadTrampolineFn(IRGenModule &IGM) {
 
@@ -66,6 +66,14 @@ namespace irgen {
   class TypeInfo;
   
 /// The helper class for generating types.
+///
+/// Each IRGenModule owns one TypeConverter, and the TypeInfo values it
+/// caches embed llvm::Type pointers from that module's LLVMContext.
+/// Because every IGM has its own context, the caches cannot be shared or
+/// made concurrent across the IRGenModules of a multi-threaded build; a
+/// bounded-generic type used from several output files is lowered once per
+/// IGM by design. The per-IGM caches need no locking for the same reason:
+/// a thread owns its IGM, and with it this converter, outright.
 class TypeConverter {
 public:
   enum class Mode : unsigned {
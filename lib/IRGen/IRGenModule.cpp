@@ -1892,6 +1892,16 @@ void IRGenModule::error(SourceLoc loc, const Twine &message) {
 
 bool IRGenModule::useDllStorage() { return ::useDllStorage(Triple); }
 
+/// Whether to emit statically-initialized metadata records for generic
+/// instantiations whose substituted layout is fully known at compile time
+/// (e.g. Optional<Int> or a fixed-layout generic struct at concrete
+/// arguments). When enabled, the metadata accessor for such a type returns
+/// the address of a constant record instead of calling
+/// swift_getGenericMetadata, which removes the runtime instantiation and
+/// its cache lookup from first-use paths. This is opt-in via
+/// -prespecialize-generic-metadata because non-Darwin-stdlib clients also
+/// need a runtime that understands prespecialized records, hence the
+/// deployment-availability check below.
 bool IRGenModule::shouldPrespecializeGenericMetadata() {
   auto canPrespecializeTarget =
       (Triple.isOSDarwin() || Triple.isOSWindows() ||
@@ -213,6 +213,17 @@ enum class TypeMetadataCanonicality : bool {
 /// In single-threaded compilation, the IRGenerator creates only a single
 /// IRGenModule. In multi-threaded compilation, it contains multiple
 /// IRGenModules - one for each LLVM module (= one for each input/output file).
+///
+/// The IRGenModule is the unit of parallelism: each one owns its
+/// llvm::Module, its LLVMContext, and all the uniquing maps for globals,
+/// metadata, and lowered types that emission relies on. llvm::Module is not
+/// thread-safe, and lazy emission (the queues below) routes an entity to
+/// whichever IGM first referenced it, so two threads can never share an IGM.
+/// This is why a single-output WMO build runs IRGen serially even under
+/// -num-threads: splitting one output across per-thread modules that are
+/// re-linked before the backend would change symbol linkage and break the
+/// function/metadata merging that relies on everything being in one module.
+/// Producing multiple output objects is the supported way to parallelize.
 class IRGenerator {
 public:
   const IRGenOptions &Opts;
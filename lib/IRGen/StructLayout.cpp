@@ -293,6 +293,17 @@ bool StructLayoutBuilder::addField(ElementLayout &elt,
   // If the rules are changed so that fields aren't necessarily laid
   // out sequentially, the computation of InstanceStart in the
   // RO-data will need to be fixed.
+  //
+  // In particular, reordering class fields by alignment to shrink padding
+  // keeps coming up. The Universal strategy used for classes pins
+  // declaration order because the layout is ABI: field offset vectors,
+  // reflection field descriptors, and remote mirrors all enumerate fields
+  // in declaration order and pair them with these offsets, and every
+  // module that can see the class (including debuggers and legacy type
+  // info) must compute the same result. An opt-in reordering mode is
+  // possible but is an ABI opt-out, not a local change here - it would
+  // need its own availability story and coordinated updates to the
+  // reflection and remote inspection stacks.
 
   // If this element is resiliently- or dependently-sized, record
   // that and configure the ElementLayout appropriately.
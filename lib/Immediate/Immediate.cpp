@@ -320,24 +320,46 @@ int swift::RunImmediately(CompilerInstance &CI,
     = getIRTargetOptions(IRGenOpts, swiftModule->getASTContext());
 
   std::unique_ptr<llvm::orc::LLJIT> JIT;
+  llvm::orc::LLLazyJIT *LazyJIT = nullptr;
 
   {
-    auto JITOrErr =
-      llvm::orc::LLJITBuilder()
-        .setJITTargetMachineBuilder(
-            llvm::orc::JITTargetMachineBuilder(llvm::Triple(Triple))
-              .setRelocationModel(llvm::Reloc::PIC_)
-              .setOptions(std::move(TargetOpt))
-              .setCPU(std::move(CPU))
-              .addFeatures(Features)
-              .setCodeGenOptLevel(llvm::CodeGenOpt::Default))
-        .create();
-
-    if (!JITOrErr) {
-      llvm::logAllUnhandledErrors(JITOrErr.takeError(), llvm::errs(), "");
-      return -1;
-    } else
+    auto TargetMachineBuilder =
+        llvm::orc::JITTargetMachineBuilder(llvm::Triple(Triple))
+            .setRelocationModel(llvm::Reloc::PIC_)
+            .setOptions(std::move(TargetOpt))
+            .setCPU(std::move(CPU))
+            .addFeatures(Features)
+            .setCodeGenOptLevel(llvm::CodeGenOpt::Default);
+
+    if (IRGenOpts.UseJITLazy) {
+      // Compile each function the first time it is called instead of
+      // compiling the whole module before running main. Scripts typically
+      // execute a small fraction of the code they declare, so this trades a
+      // per-function stub indirection for a much shorter time to first
+      // statement.
+      auto JITOrErr =
+          llvm::orc::LLLazyJITBuilder()
+              .setJITTargetMachineBuilder(std::move(TargetMachineBuilder))
+              .create();
+
+      if (!JITOrErr) {
+        llvm::logAllUnhandledErrors(JITOrErr.takeError(), llvm::errs(), "");
+        return -1;
+      }
+      LazyJIT = JITOrErr->get();
       JIT = std::move(*JITOrErr);
+    } else {
+      auto JITOrErr =
+          llvm::orc::LLJITBuilder()
+              .setJITTargetMachineBuilder(std::move(TargetMachineBuilder))
+              .create();
+
+      if (!JITOrErr) {
+        llvm::logAllUnhandledErrors(JITOrErr.takeError(), llvm::errs(), "");
+        return -1;
+      } else
+        JIT = std::move(*JITOrErr);
+    }
   }
 
   auto Module = GenModule.getModule();
@@ -368,7 +390,10 @@ int swift::RunImmediately(CompilerInstance &CI,
              Module->dump());
 
   {
-    if (auto Err = JIT->addIRModule(std::move(GenModule).intoThreadSafeContext())) {
+    auto TSM = std::move(GenModule).intoThreadSafeContext();
+    auto Err = LazyJIT ? LazyJIT->addLazyIRModule(std::move(TSM))
+                       : JIT->addIRModule(std::move(TSM));
+    if (Err) {
       llvm::logAllUnhandledErrors(std::move(Err), llvm::errs(), "");
       return -1;
     }
@@ -276,6 +276,16 @@ StringRef StdlibGroupsIndexRecordingConsumer::findGroupForSymbol(const IndexSymb
   llvm_unreachable("did not find group name for reference");
 }
 
+// Records go through clang's IndexRecordWriter, i.e. the libIndexStore
+// bitstream format: binary, with symbols interned per record and whole
+// records deduplicated store-wide by content hash (the AlreadyExists
+// result below — unchanged files cost no new output on rebuilds).  A
+// string table shared across the records of a module would undo that
+// sharing, since records could no longer be validated or reused
+// independently by indexstore consumers.  Emission itself stays on the
+// frontend's thread: it walks AST and Sema state that is not safe to
+// touch concurrently, so parallelism across files is the build system's
+// job — it already runs primary files in separate frontend invocations.
 static bool writeRecord(SymbolTracker &record, std::string Filename,
                         std::string indexStorePath, DiagnosticEngine *diags,
                         std::string &outRecordFile) {
@@ -14,6 +14,17 @@
 // and other runtime entrypoints. Most of this code will be removed once the SIL
 // level ARC optimizer causes it to no longer be needed.
 //
+// This pass is intentionally intra-procedural and intentionally minimal.
+// Cross-call retain/release pairing belongs at the SIL level, where
+// ownership semantics, function side effects, and deinit barriers are
+// explicit; down here a swift_retain is just a call, and proving that a
+// callee does not observe or disturb a reference count would mean
+// re-deriving at the IR level facts that SIL already had and lost in
+// lowering. What this pass legitimately catches is the residue that LLVM
+// inlining exposes after SIL is gone - pairs that became local to one
+// function body. Pairs still separated by a call boundary at this point
+// are ones SIL could not remove for semantic reasons, not missed ones.
+//
 //===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "swift-llvm-arc-opts"
@@ -23,6 +23,10 @@ using namespace llvm::opt;
 #include "swift/Option/Options.inc"
 #undef PREFIX
 
+// The option table is fully precomputed: Options.inc is generated by tablegen
+// at build time and InfoTable below is constant static data, so constructing a
+// SwiftOptTable at runtime allocates one small object over the shared table.
+// There is no per-process parse or table-building cost to amortize here.
 static const OptTable::Info InfoTable[] = {
 #define OPTION(PREFIX, NAME, ID, KIND, GROUP, ALIAS, ALIASARGS, FLAGS, PARAM,  \
                HELPTEXT, METAVAR, VALUES)                                      \
@@ -33,6 +33,14 @@
 
 #include <limits>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define SWIFT_LEXER_FAST_SCAN_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define SWIFT_LEXER_FAST_SCAN_NEON 1
+#endif
+
 // Regex lexing delivered via libSwift.
 static RegexLiteralLexingFn regexLiteralLexingFn = nullptr;
 void Parser_registerRegexLiteralLexingFn(RegexLiteralLexingFn fn) {
@@ -378,12 +386,163 @@ static void diagnoseEmbeddedNul(DiagnosticEngine *Diags, const char *Ptr) {
       .fixItRemoveChars(NulLoc, NulEndLoc);
 }
 
+//===----------------------------------------------------------------------===//
+// Vectorized scanning fast paths
+//===----------------------------------------------------------------------===//
+//
+// Large mechanically generated sources are dominated by long runs of ASCII
+// identifier characters, horizontal whitespace and comment bodies. The
+// helpers below advance over such runs 16 bytes at a time on SSE2/NEON
+// targets, stopping at any byte the caller's slow path needs to look at
+// individually (in particular any non-ASCII byte), so Unicode validation
+// and identifier rules remain byte-exact. On other targets they degrade to
+// the plain scalar loops the callers used to contain.
+
+/// Advance \p Ptr over a run of ASCII identifier continuation characters
+/// [a-zA-Z0-9_$]. Stops at the first byte outside that set, including any
+/// non-ASCII byte, which is left for the caller's Unicode-aware path.
+static void skipAsciiIdentifierRun(const char *&Ptr, const char *End) {
+#if SWIFT_LEXER_FAST_SCAN_SSE2
+  while (End - Ptr >= 16) {
+    __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Ptr));
+    // Signed compares reject bytes >= 0x80 from every range below, so
+    // non-ASCII bytes always stop the scan.
+    auto inRange = [&](char Lo, char Hi) {
+      return _mm_and_si128(_mm_cmpgt_epi8(Chunk, _mm_set1_epi8(Lo - 1)),
+                           _mm_cmplt_epi8(Chunk, _mm_set1_epi8(Hi + 1)));
+    };
+    __m128i IsIdent = _mm_or_si128(
+        _mm_or_si128(inRange('a', 'z'), inRange('A', 'Z')),
+        _mm_or_si128(inRange('0', '9'),
+                     _mm_or_si128(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8('_')),
+                                  _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('$')))));
+    unsigned Mask = _mm_movemask_epi8(IsIdent);
+    if (Mask != 0xFFFF) {
+      Ptr += llvm::countTrailingOnes(Mask);
+      return;
+    }
+    Ptr += 16;
+  }
+#elif SWIFT_LEXER_FAST_SCAN_NEON
+  while (End - Ptr >= 16) {
+    uint8x16_t Chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(Ptr));
+    auto inRange = [&](uint8_t Lo, uint8_t Hi) {
+      return vandq_u8(vcgeq_u8(Chunk, vdupq_n_u8(Lo)),
+                      vcleq_u8(Chunk, vdupq_n_u8(Hi)));
+    };
+    uint8x16_t IsIdent = vorrq_u8(
+        vorrq_u8(inRange('a', 'z'), inRange('A', 'Z')),
+        vorrq_u8(inRange('0', '9'),
+                 vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8('_')),
+                          vceqq_u8(Chunk, vdupq_n_u8('$')))));
+    if (vminvq_u8(IsIdent) != 0xFF)
+      break;
+    Ptr += 16;
+  }
+#endif
+  while (Ptr < End && clang::isAsciiIdentifierContinue(*Ptr, /*dollar*/ true))
+    ++Ptr;
+}
+
+/// Advance \p Ptr over a run of horizontal whitespace characters
+/// (space, tab, vertical tab and form feed).
+static void skipHorizontalWhitespaceRun(const char *&Ptr, const char *End) {
+#if SWIFT_LEXER_FAST_SCAN_SSE2
+  while (End - Ptr >= 16) {
+    __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Ptr));
+    __m128i IsWS = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8(' ')),
+                     _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\t'))),
+        _mm_or_si128(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\v')),
+                     _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\f'))));
+    unsigned Mask = _mm_movemask_epi8(IsWS);
+    if (Mask != 0xFFFF) {
+      Ptr += llvm::countTrailingOnes(Mask);
+      return;
+    }
+    Ptr += 16;
+  }
+#elif SWIFT_LEXER_FAST_SCAN_NEON
+  while (End - Ptr >= 16) {
+    uint8x16_t Chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(Ptr));
+    uint8x16_t IsWS =
+        vorrq_u8(vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8(' ')),
+                          vceqq_u8(Chunk, vdupq_n_u8('\t'))),
+                 vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8('\v')),
+                          vceqq_u8(Chunk, vdupq_n_u8('\f'))));
+    if (vminvq_u8(IsWS) != 0xFF)
+      break;
+    Ptr += 16;
+  }
+#endif
+  while (Ptr < End &&
+         (*Ptr == ' ' || *Ptr == '\t' || *Ptr == '\v' || *Ptr == '\f'))
+    ++Ptr;
+}
+
+/// Advance \p Ptr over comment-body bytes that need no individual handling.
+/// Always stops at line terminators and NUL; additionally stops at '*' and
+/// '/' when \p StopAtDelimiters is set (for block comments) and at non-ASCII
+/// bytes when \p StopAtNonAscii is set (when UTF-8 runs must be validated).
+static void skipPlainCommentBytes(const char *&Ptr, const char *End,
+                                  bool StopAtDelimiters,
+                                  bool StopAtNonAscii) {
+#if SWIFT_LEXER_FAST_SCAN_SSE2
+  while (End - Ptr >= 16) {
+    __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Ptr));
+    __m128i Stop = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\n')),
+                     _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\r'))),
+        _mm_cmpeq_epi8(Chunk, _mm_setzero_si128()));
+    if (StopAtDelimiters)
+      Stop = _mm_or_si128(
+          Stop, _mm_or_si128(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8('*')),
+                             _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('/'))));
+    if (StopAtNonAscii)
+      Stop = _mm_or_si128(Stop, _mm_cmplt_epi8(Chunk, _mm_setzero_si128()));
+    unsigned Mask = _mm_movemask_epi8(Stop);
+    if (Mask != 0) {
+      Ptr += llvm::countTrailingZeros(Mask);
+      return;
+    }
+    Ptr += 16;
+  }
+#elif SWIFT_LEXER_FAST_SCAN_NEON
+  while (End - Ptr >= 16) {
+    uint8x16_t Chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(Ptr));
+    uint8x16_t Stop = vorrq_u8(vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8('\n')),
+                                        vceqq_u8(Chunk, vdupq_n_u8('\r'))),
+                               vceqq_u8(Chunk, vdupq_n_u8(0)));
+    if (StopAtDelimiters)
+      Stop = vorrq_u8(Stop, vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8('*')),
+                                     vceqq_u8(Chunk, vdupq_n_u8('/'))));
+    if (StopAtNonAscii)
+      Stop = vorrq_u8(Stop, vcgeq_u8(Chunk, vdupq_n_u8(0x80)));
+    if (vmaxvq_u8(Stop) != 0)
+      break;
+    Ptr += 16;
+  }
+#endif
+  while (Ptr < End) {
+    char C = *Ptr;
+    if (C == '\n' || C == '\r' || C == 0)
+      return;
+    if (StopAtDelimiters && (C == '*' || C == '/'))
+      return;
+    if (StopAtNonAscii && (signed char)C < 0)
+      return;
+    ++Ptr;
+  }
+}
+
 /// Advance \p CurPtr to the end of line or the end of file. Returns \c true
 /// if it stopped at the end of line, \c false if it stopped at the end of file.
 static bool advanceToEndOfLine(const char *&CurPtr, const char *BufferEnd,
                                const char *CodeCompletionPtr = nullptr,
                                DiagnosticEngine *Diags = nullptr) {
   while (1) {
+    skipPlainCommentBytes(CurPtr, BufferEnd, /*StopAtDelimiters=*/false,
+                          /*StopAtNonAscii=*/Diags != nullptr);
     switch (*CurPtr++) {
     case '\n':
     case '\r':
@@ -450,6 +609,8 @@ static bool skipToEndOfSlashStarComment(const char *&CurPtr,
   bool isMultiline = false;
 
   while (1) {
+    skipPlainCommentBytes(CurPtr, BufferEnd, /*StopAtDelimiters=*/true,
+                          /*StopAtNonAscii=*/Diags != nullptr);
     switch (*CurPtr++) {
     case '*':
       // Check for a '*/'
@@ -668,7 +829,11 @@ void Lexer::lexIdentifier() {
   (void) didStart;
 
   // Lex [a-zA-Z_$0-9[[:XID_Continue:]]]*
-  while (advanceIfValidContinuationOfIdentifier(CurPtr, BufferEnd));
+  while (true) {
+    skipAsciiIdentifierRun(CurPtr, BufferEnd);
+    if (!advanceIfValidContinuationOfIdentifier(CurPtr, BufferEnd))
+      break;
+  }
 
   tok Kind = kindOfIdentifier(StringRef(TokStart, CurPtr-TokStart),
                               LexMode == LexerMode::SIL);
@@ -2844,6 +3009,7 @@ Restart:
   case '\t':
   case '\v':
   case '\f':
+    skipHorizontalWhitespaceRun(CurPtr, BufferEnd);
     goto Restart;
   case '/':
     if (IsForTrailingTrivia || isKeepingComments()) {
@@ -3043,6 +3209,61 @@ SourceLoc Lexer::getLocForStartOfToken(SourceManager &SM, unsigned BufferID,
                                     /*BufferEnd=*/Buffer.size());
 }
 
+CharSourceRange Lexer::getDamagedRegionForEdit(SourceManager &SM,
+                                               unsigned BufferID,
+                                               CharSourceRange ReplacementRange,
+                                               llvm::Optional<State> AnchorState) {
+  CharSourceRange BufferRange = SM.getRangeForBuffer(BufferID);
+  if (!ReplacementRange.isValid() ||
+      !BufferRange.contains(ReplacementRange.getStart()))
+    return BufferRange;
+
+  SourceLoc EditStart = ReplacementRange.getStart();
+  SourceLoc EditEnd = ReplacementRange.getEnd();
+
+  // Use fake language options; language options only affect validity and the
+  // exact token kind produced, not token extents.
+  LangOptions FakeLangOpts;
+  Lexer L(FakeLangOpts, SM, BufferID, /*Diags=*/nullptr, LexerMode::Swift,
+          HashbangMode::Allowed, CommentRetentionMode::ReturnAsTokens);
+  if (AnchorState) {
+    L.restoreState(*AnchorState);
+  } else {
+    // Without an anchor, resume from the start of the token containing the
+    // edit (or from the edit itself, if it landed in trivia).
+    SourceLoc Start = getLocForStartOfToken(SM, EditStart);
+    if (Start.isInvalid())
+      Start = EditStart;
+    L.restoreState(State(Start));
+  }
+
+  // Scan forward to the first token that overlaps or follows the edit. A
+  // partially edited token is re-lexed whole, so the damage begins at that
+  // token's start; if the edit landed in trivia, it begins at the edit.
+  Token Tok;
+  while (true) {
+    L.lex(Tok);
+    if (Tok.is(tok::eof))
+      return CharSourceRange(SM, EditStart, BufferRange.getEnd());
+    SourceLoc TokEnd = Tok.getLoc().getAdvancedLoc(Tok.getLength());
+    if (SM.isBeforeInBuffer(EditStart, TokEnd))
+      break;
+  }
+  SourceLoc DamageStart =
+      SM.isBeforeInBuffer(Tok.getLoc(), EditStart) ? Tok.getLoc() : EditStart;
+
+  // Keep lexing until a token begins at or beyond the end of the replacement;
+  // its start is the first position where a lexer resuming with its pre-edit
+  // state would produce identical output. Multi-line tokens overlapping the
+  // edit keep the loop going until they end.
+  while (SM.isBeforeInBuffer(Tok.getLoc(), EditEnd)) {
+    L.lex(Tok);
+    if (Tok.is(tok::eof))
+      return CharSourceRange(SM, DamageStart, BufferRange.getEnd());
+  }
+  return CharSourceRange(SM, DamageStart, Tok.getLoc());
+}
+
 SourceLoc Lexer::getLocForStartOfLine(SourceManager &SM, SourceLoc Loc) {
   // Don't try to do anything with an invalid location.
   if (Loc.isInvalid())
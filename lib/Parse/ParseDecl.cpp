@@ -8332,6 +8332,13 @@ void Parser::parseAbstractFunctionBody(AbstractFunctionDecl *AFD) {
         PD_Default, AFD, BodyRange, BodyPreviousLoc);
   };
 
+  // Note that the delay decision and the skip over the body are recomputed
+  // on every invocation, even when the file is unchanged since the last one.
+  // Persisting the skipped ranges (and a fingerprint to validate them) has
+  // been explored, but an index is only worth its on-disk format once
+  // something installs it and reads it back - which needs an IDE-side
+  // driver that owns the index lifetime across invocations. Until such a
+  // consumer exists, re-lexing the body here is the simpler cost.
   bool HasNestedTypeDeclarations;
   if (canDelayFunctionBodyParsing(HasNestedTypeDeclarations)) {
     BodyRange.End = PreviousLoc;
@@ -6888,6 +6888,18 @@ void SILModule::verify(bool isCompleteOSSA, bool checkLinearLifetime) const {
 }
 
 /// Verify the module.
+///
+/// Regarding the recurring wish to fan this loop out over a thread pool:
+/// verifying a function is not read-only with respect to the module.
+/// SILVerifier queries lazily-populated shared state - type lowering
+/// through SILModule's TypeConverter, dominance and dead-end-block
+/// analyses through the pass manager - none of which is synchronized, so
+/// concurrent f.verify() calls race on cache fills. Making verification
+/// parallel means making those caches concurrent first; do not bolt a
+/// thread pool onto this loop as-is. The cheaper lever for assert-build
+/// latency already exists: -sil-verify-all re-verifies just the function a
+/// function pass changed, right after the pass, so whole-module sweeps can
+/// be reserved for pipeline boundaries (see runPassOnFunction).
 void SILModule::verify(SILPassManager *passManager,
                        bool isCompleteOSSA, bool checkLinearLifetime) const {
   if (!verificationEnabled(*this))
@@ -659,6 +659,9 @@ bool AliasAnalysis::canBuiltinDecrementRefCount(BuiltinInst *BI, SILValue Ptr) {
 
 namespace {
 
+/// Holds one AliasAnalysis instance - and thereby one set of query caches -
+/// per function, shared by all passes in the pipeline until a pass
+/// invalidates the function's instructions.
 class AliasAnalysisContainer : public FunctionAnalysisBase<AliasAnalysis> {
   SILPassManager *PM = nullptr;
 
@@ -9,6 +9,20 @@
 // See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
 //
 //===----------------------------------------------------------------------===//
+//
+// This pass, together with COWArrayOpt and the ARC optimizer, defines SIL's
+// role in loop vectorization: remove the Swift-specific obstacles - bounds
+// checks, uniqueness checks, retains/releases in the loop body - and hand
+// LLVM a loop it can vectorize with its own cost model and target
+// knowledge. SIL deliberately does not emit vector operations itself;
+// duplicating LLVM's legality and profitability analysis on Builtin.vec
+// would be a second vectorizer to maintain with strictly less target
+// information. When a numeric kernel fails to vectorize, the productive
+// question is which check or ARC operation this pipeline failed to hoist
+// or eliminate, and the -Rpass-missed=loop-vectorize remarks from LLVM
+// usually name it.
+//
+//===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "sil-abcopts"
 
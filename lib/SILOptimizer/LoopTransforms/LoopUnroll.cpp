@@ -9,6 +9,21 @@
 // See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
 //
 //===----------------------------------------------------------------------===//
+//
+// This is the extent of SIL's loop restructuring: full unrolling of small
+// constant-trip-count loops. Interchange and unroll-and-jam for nested
+// loops have come up repeatedly for row/column Array kernels, but both are
+// reorderings, and proving a reordering legal takes memory dependence
+// distances between subscript accesses across iterations. SIL has no
+// dependence analysis; ArraySemantic.cpp recognizes what a call *is*
+// (get_element, check_subscript), not how two accesses in different
+// iterations relate. Until such an analysis exists, the job of this
+// pipeline for nested kernels is the one described at the top of
+// ArrayBoundsCheckOpts.cpp: strip the checks and ARC traffic so the loop
+// nest reaches LLVM clean enough for its interchange and unroll-and-jam
+// passes, which already own the dependence machinery, to fire.
+//
+//===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "sil-loopunroll"
 
@@ -56,6 +56,12 @@ llvm::cl::opt<bool> SILPrintPassName(
     "sil-print-pass-name", llvm::cl::init(false),
     llvm::cl::desc("Print the name of each SIL pass before it runs"));
 
+// Together these two options answer "which pass on which function burned
+// the time": each pass run over the threshold is reported with its tag,
+// run number, and the function it ran on.  This is the per-(pass,
+// function) attribution that a flame-graph style trace would carry; the
+// frontend has no chrome-trace stream to feed spans into, so text output
+// filtered by -sil-min-pass-time is the supported form.
 llvm::cl::opt<bool> SILPrintPassTime(
     "sil-print-pass-time", llvm::cl::init(false),
     llvm::cl::desc("Print the execution time of each SIL pass"));
@@ -681,6 +687,21 @@ void SILPassManager::runPassOnFunction(unsigned TransIdx, SILFunction *F) {
   ++NumPassesRun;
 }
 
+/// Run the function-pass pipeline [FromTransIdx, ToTransIdx) over all
+/// function definitions, visiting callees before callers.
+///
+/// The bottom-up order means functions in unrelated call-graph subtrees
+/// are in principle independent, but the pipeline still has to run them
+/// one at a time. All SIL for the module lives in the SILModule's single
+/// bump-pointer allocator, function passes deserialize callees and kick
+/// off ASTContext requests on demand, and inter-procedural analyses like
+/// BasicCalleeAnalysis are invalidated and lazily recomputed as functions
+/// change under them — none of which tolerates concurrent mutation.
+/// Running functions concurrently would also have to preserve the
+/// restart-and-worklist semantics below, where a pass may push newly
+/// specialized callees that must complete their pipeline before their
+/// caller proceeds. Those are the prerequisites to solve before this
+/// loop can fan out to a worker pool.
 void SILPassManager::
 runFunctionPasses(unsigned FromTransIdx, unsigned ToTransIdx) {
   if (ToTransIdx <= FromTransIdx)
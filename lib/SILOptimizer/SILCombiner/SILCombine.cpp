@@ -48,6 +48,19 @@ using namespace swift;
 
 STATISTIC(NumCombined, "Number of instructions combined");
 STATISTIC(NumDeadInst, "Number of dead insts eliminated");
+STATISTIC(NumIterations, "Number of sil-combine iterations performed");
+STATISTIC(NumIterationLimitHit,
+          "Number of functions that hit the sil-combine iteration limit");
+
+// A full iteration re-scans the whole function, so on very large functions
+// each extra iteration is expensive. The limit exists to bound compile time
+// on pathological (usually machine-generated) inputs; normal code reaches a
+// fixed point within a handful of iterations.
+static llvm::cl::opt<unsigned> SILCombineMaxIterations(
+    "sil-combine-max-iterations",
+    llvm::cl::desc("Maximum number of iterations of the whole worklist "
+                   "algorithm per function"),
+    llvm::cl::init(30), llvm::cl::Hidden);
 
 static llvm::cl::opt<bool> EnableSinkingOwnedForwardingInstToUses(
     "silcombine-owned-code-sinking",
@@ -503,10 +516,23 @@ bool SILCombiner::runOnFunction(SILFunction &F) {
   clear();
 
   bool Changed = false;
-  // Perform iterations until we do not make any changes.
+  // Perform iterations until we do not make any changes, or we hit the
+  // iteration limit. Within one iteration the worklist is already def-use
+  // driven: transforms re-enqueue only the users of values they change and
+  // instructions they create. The outer loop re-scans the function to catch
+  // effects the worklist cannot track, such as CFG simplifications exposing
+  // new combines in other blocks.
   while (doOneIteration(F, Iteration)) {
     Changed = true;
     ++Iteration;
+    ++NumIterations;
+    if (Iteration >= SILCombineMaxIterations) {
+      ++NumIterationLimitHit;
+      LLVM_DEBUG(llvm::dbgs() << "SC: hit iteration limit ("
+                              << SILCombineMaxIterations << ") on "
+                              << F.getName() << '\n');
+      break;
+    }
   }
 
   if (invalidatedStackNesting) {
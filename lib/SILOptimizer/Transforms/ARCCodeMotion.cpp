@@ -64,9 +64,22 @@
 ///
 /// TODO: There are a lot of code duplications between retain and release code
 /// motion in the data flow part. Consider whether we can share them.
-/// Essentially, we can implement the release code motion by inverting the 
+/// Essentially, we can implement the release code motion by inverting the
 /// retain code motion, but this can also make the code less readable.
 ///
+/// Relation to classic PRE: the optimistic dataflow here already plays the
+/// role of the anticipated/available sets, per RC root, and because the pass
+/// splits critical edges up front (see the transform's run() below), the new
+/// ops it materializes at block boundaries are exactly PRE's edge
+/// compensation code. What is *not* PRE-complete is the placement policy:
+/// the fixpoint picks the latest legal point for retains and the earliest
+/// for releases with no notion of frequency, so an op that is redundant on
+/// the hot path but needed on a cold one ends up at the join, executed on
+/// both. Doing better means weighting insertion points with ColdBlockInfo
+/// (or real profile data once SIL carries it) and accepting duplication on
+/// cold edges; the dataflow would not change, only the choice among the
+/// legal insertion points it discovers.
+///
 //===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "sil-rr-code-motion"
@@ -51,6 +51,17 @@
 /// instructions. Ignoring any access pattern would weaken enforcement. For
 /// example, AccessStorageAnalysis cannot be used here because that analysis
 /// may conservatively summarize some functions.
+///
+/// The same completeness requirement is what keeps this a *module* pass. A
+/// cross-module variant - serializing per-module access summaries so a
+/// client can drop dynamic enforcement on imported storage - inherits both
+/// problems at once: the summaries would come from AccessStorageAnalysis,
+/// which is conservative in exactly the way ruled out above, and promotion
+/// of shared storage is only sound if every module that will ever touch the
+/// storage has been summarized, a promise neither the build system nor
+/// dlopen lets us make today. Until there is a closed-world link step that
+/// can re-verify the union of summaries, accesses to imported globals and
+/// class properties have to keep their dynamic checks.
 //===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "access-enforcement-wmo"
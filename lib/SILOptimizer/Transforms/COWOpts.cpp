@@ -12,6 +12,30 @@
 //
 // This pass optimizes begin_cow_mutation and end_cow_mutation patterns.
 //
+// This is also the last point where redundant uniqueness checks can be
+// removed. Once IRGen lowers begin_cow_mutation, the check becomes a
+// ref-count load and compare on the object header, and no later pass can
+// prove it redundant: at the IR level any intervening call might have
+// retained the buffer, so a dominating earlier check proves nothing. The
+// fact that uniqueness is stable while the buffer does not escape is a
+// SIL-level invariant (modeled here via end_cow_mutation [keep_unique]
+// and escape-point collection) that does not survive lowering. If a
+// ref-count load still executes per loop iteration, the fix is to widen
+// this pass's escape reasoning, not to add a late IR cleanup.
+//
+// The pass is strictly intra-procedural, so an out-of-line mutation helper
+// hides its end_cow_mutation from callers. The supported way to cross that
+// boundary is to erase it: mark the helper @inline(__always) or @inlinable
+// so the performance inliner runs it into the caller before this pass sees
+// the code. An interprocedural variant - a callee summary recording
+// "argument buffer is left unique", or a caller-side promise that a unique
+// buffer is passed in - would need more than plumbing: uniqueness dies with
+// any retain, so the summary must prove the callee performs no retain of
+// the buffer between entry and its begin_cow_mutation, and an annotation
+// claiming this has to be verified against the callee body or it is just an
+// unsafe assertion. That verification is the same escape/retain reasoning
+// done here, run bottom-up over the call graph.
+//
 //===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "cow-opts"
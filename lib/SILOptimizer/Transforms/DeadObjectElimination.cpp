@@ -21,6 +21,20 @@
 // escape or is used in a way that could cause side effects. If both of those
 // conditions apply, the alloc_ref and its entire use graph is eliminated.
 //
+// Uses must be locally visible: canZapInstruction() rejects applies, so
+// handing the object to any callee - even one that merely reads a field -
+// keeps the allocation alive. The summary half of fixing that already
+// exists: ComputeEscapeEffects derives per-argument escape effects that are
+// serialized with the function and consumed by alias analysis, so "does the
+// callee let the object escape" is answerable today. What is still missing
+// is the removal half. Zapping an apply means deleting the call, which is
+// only sound when the callee is also free of other side effects and its
+// result is dead; that needs the callee's side-effect summary consulted
+// alongside the escape effects, plus a story for partial applies and
+// reabstraction thunks on the way to the callee. Extending the zappable set
+// to such calls is the right shape for the improvement - not a new summary
+// format.
+//
 //===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "dead-object-elim"
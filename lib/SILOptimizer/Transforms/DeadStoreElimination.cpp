@@ -181,13 +181,21 @@ namespace {
 /// # of BBs x(times) # of locations.
 ///
 /// we could run DSE on functions with 256 basic blocks and 256 locations,
-/// which is a large function.  
+/// which is a large function.
 constexpr unsigned MaxLSLocationBBMultiplicationNone = 256*256;
 
 /// we could run optimistic DSE on functions with less than 64 basic blocks
 /// and 64 locations which is a sizable function.
 constexpr unsigned MaxLSLocationBBMultiplicationPessimistic = 64*64;
 
+/// A function whose data flow converges in a single post-order iteration
+/// skips the genset/killset computation entirely, so it can afford a much
+/// larger # of BBs x # of locations product before the remaining single
+/// pessimistic pass becomes too expensive. Large machine-generated
+/// serializers typically fall in this category: thousands of stores but an
+/// almost linear CFG.
+constexpr unsigned MaxLSLocationBBMultiplicationOneIteration = 512*512;
+
 /// forward declaration.
 class DSEContext;
 /// BlockState summarizes how LSLocations are used in a basic block.
@@ -582,14 +590,19 @@ DSEContext::ProcessKind DSEContext::getProcessFunctionKind(unsigned StoreCount)
     HandledBBs.insert(B);
   }
 
+  // This function's data flow would converge in 1 iteration. There is no
+  // genset/killset computation in this mode, so grant it a larger budget
+  // before giving up: the single pessimistic pass is all we pay.
+  if (RunOneIteration) {
+    if (BBCount * LocationCount > MaxLSLocationBBMultiplicationOneIteration)
+      return ProcessKind::ProcessNone;
+    return ProcessKind::ProcessPessimistic;
+  }
+
   // Data flow may take too long to run.
   if (BBCount * LocationCount > MaxLSLocationBBMultiplicationNone)
     return ProcessKind::ProcessNone;
 
-  // This function's data flow would converge in 1 iteration.
-  if (RunOneIteration)
-    return ProcessKind::ProcessPessimistic;
-  
   // We run one pessimistic data flow to do dead store elimination on
   // the function.
   if (BBCount * LocationCount > MaxLSLocationBBMultiplicationPessimistic)
@@ -28,6 +28,17 @@
 /// TODO: We have not determined whether to support inexact type checks. It
 /// will be a tradeoff between utility of the attribute vs. cost of the check.
 ///
+/// Note on profile-guided specialization: everything below is driven by the
+/// attribute's type list and does not care where that list came from, so a
+/// type profile collected in production is already actionable — translate
+/// the top observed types per generic entry point into @_specialize
+/// attributes (exported: true if clients should pick them up) and this pass
+/// emits the specializations and the guarded dispatch. Consuming a profile
+/// file directly instead would need two pieces we don't have: a runtime
+/// hook cheap enough to log %T metadata per generic entry, and a way to key
+/// profile entries to functions that survives mangled-name churn between
+/// the profiled build and the optimized one.
+///
 //===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "eager-specializer"
@@ -44,6 +44,12 @@ llvm::cl::opt<bool>
     EnableSILAggressiveInlining("sil-aggressive-inline", llvm::cl::init(false),
                                llvm::cl::desc("Enable aggressive inlining"));
 
+llvm::cl::opt<unsigned> SILColdCallSiteDivisor(
+    "sil-inline-cold-call-site-divisor", llvm::cl::init(50),
+    llvm::cl::desc("When profiling the caller, a call site executed fewer "
+                   "than 1/N times per function entry is considered cold and "
+                   "only trivial callees are inlined into it."));
+
 llvm::cl::opt<bool> EnableVerifyAfterInlining(
     "sil-inline-verify-after-inline", llvm::cl::init(false),
     llvm::cl::desc("Run sil verification after inlining all found callee apply "
@@ -268,6 +274,18 @@ bool SILPerformanceInliner::profileBasedDecision(
                                "reason= Never Called.\n");
     return false;
   }
+  auto callerEntryCount = AI.getFunction()->getEntryCount();
+  if (callerEntryCount && SILColdCallSiteDivisor > 0 &&
+      callerCount < callerEntryCount.getValue() / SILColdCallSiteDivisor) {
+    // The call site is executed on a small fraction of the caller's
+    // entries - it is cold and inlining a non-trivial callee here only
+    // grows the code.
+    LLVM_DEBUG(dumpCaller(AI.getFunction());
+               llvm::dbgs() << "profiled decision: NO, reason=cold site "
+                            << callerCount << '/'
+                            << callerEntryCount.getValue() << '\n');
+    return false;
+  }
   auto calleeCount = Callee->getEntryCount();
   if (calleeCount) {
     // If we have Callee count - use SI heuristic:
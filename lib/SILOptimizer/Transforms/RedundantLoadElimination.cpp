@@ -70,6 +70,22 @@
 /// same instruction, and then use extraction to obtain the needed components
 /// of the base.
 ///
+/// A note on complexity: this dataflow is dense - bitvectors sized by the
+/// location vault, per block - and DeadStoreElimination runs the same scheme
+/// independently, so both go quadratic on huge generated functions (DSE
+/// gives up beyond 500 locations for exactly that reason). The oft-proposed
+/// fix is a shared MemorySSA-style analysis: memory states with def-use
+/// edges, built once, maintained by the pass manager, queried sparsely by
+/// both passes. Two things make that a project rather than a refactor.
+/// First, invalidation: every pass that touches memory instructions would
+/// have to preserve or rebuild the memory graph, a maintenance contract
+/// nothing in lib/SILOptimizer/Analysis currently imposes. Second,
+/// granularity: MemorySSA chains order whole memory states, while the
+/// precision of RLE/DSE lives in field-level LSLocations; a faithful port
+/// still needs location splitting layered on the sparse walk. The sparse
+/// form pays off only if most queries skip most of the function, which for
+/// RLE's must-available intersection has to be demonstrated, not assumed.
+///
 //===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "sil-redundant-load-elim"
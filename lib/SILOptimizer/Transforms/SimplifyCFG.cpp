@@ -447,8 +447,13 @@ static bool tryDominatorBasedSimplifications(
 
 /// Propagate values of branched upon values along the outgoing edges down the
 /// dominator tree.
+///
+/// \p ChangedCFG is set if an edge was actually jump-threaded. Pure value
+/// propagation replaces operands of dominated instructions and leaves the
+/// CFG - and therefore the dominator tree - intact.
 bool SimplifyCFG::dominatorBasedSimplifications(SILFunction &Fn,
-                                                DominanceInfo *DT) {
+                                                DominanceInfo *DT,
+                                                bool &ChangedCFG) {
   bool Changed = false;
   // Collect jump threadable edges and propagate outgoing edge values of
   // conditional branches/switches.
@@ -476,6 +481,7 @@ bool SimplifyCFG::dominatorBasedSimplifications(SILFunction &Fn,
       return Changed;
     if (threadEdge(ThreadInfo)) {
       Changed = true;
+      ChangedCFG = true;
     }
   }
 
@@ -587,16 +593,22 @@ bool SimplifyCFG::dominatorBasedSimplify(DominanceAnalysis *DA) {
       DT->verify();
 
     // Jump thread.
-    if (dominatorBasedSimplifications(Fn, DT)) {
+    bool ThreadedCFG = false;
+    if (dominatorBasedSimplifications(Fn, DT, ThreadedCFG)) {
       if (!transform.continueWithNextSubpassRun())
         return true;
       DominanceInfo *InvalidDT = DT;
       DT = nullptr;
       HasChangedInCurrentIter = true;
       // Simplify terminators.
-      simplifyThreadedTerminators();
+      bool SimplifiedCFG = simplifyThreadedTerminators();
       DT = InvalidDT;
-      DT->recalculate(Fn);
+      // Rebuilding dominance is O(blocks) and dominates this loop on large
+      // machine-generated CFGs. If neither jump threading nor terminator
+      // simplification changed an edge, only operands of dominated
+      // instructions were rewritten and the tree is still valid.
+      if (ThreadedCFG || SimplifiedCFG)
+        DT->recalculate(Fn);
     }
 
     Changed |= HasChangedInCurrentIter;
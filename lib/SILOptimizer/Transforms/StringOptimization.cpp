@@ -53,6 +53,19 @@ namespace {
 /// If we want to make this optimization more powerful it's best done by using
 /// the ConstExprStepEvaluator (which is currently lacking a few features to be
 /// used for this optimization).
+///
+/// Concretely, folding whole interpolations with constant-foldable arguments
+/// ("x=\(2+2)", enum raw values) would follow the OSLogOptimization
+/// blueprint: interpret the interpolation calls with the evaluator, then
+/// materialize the resulting symbolic string as a literal. What stops a
+/// direct transplant is that OSLog's interpolation types are purpose-built
+/// for interpretation - every method on the path is annotated
+/// @_semantics("constant_evaluable") and checked by the
+/// ConstantEvaluableSubsetChecker - whereas DefaultStringInterpolation's
+/// append paths carry no such annotation and make no promise to stay within
+/// the evaluator's instruction subset across stdlib changes. Annotating and
+/// maintaining that path in the stdlib is the prerequisite; the pass work
+/// afterwards is mechanical.
 class StringOptimization {
 
   struct StringInfo {
@@ -139,6 +139,19 @@ static bool isEffectivelyFinalMethod(FullApplySite applySite, CanType classType,
 /// - or it is private and has not sub-classes
 /// - or it is an internal class without sub-classes and
 ///   it is a whole-module compilation.
+///
+/// This is deliberately a module-at-a-time judgment. Calls into class
+/// hierarchies rooted in *other* modules stay virtual here because a
+/// swiftmodule carries no closed-world guarantee: a public or package class
+/// can grow subclasses in any client, and even an internal hierarchy can be
+/// extended by @testable imports. The pieces of a whole-program answer that
+/// do exist today are CrossModuleOptimization (which serializes
+/// effectively-final members so clients can devirtualize after deserializing
+/// them) and the library-evolution split, where non-resilient modules
+/// already promise their layout. Going further — per-module vtable and
+/// hierarchy summaries consumed by a link-time pass — would additionally
+/// need a closed-world mode in the build system, since dlopen'd images and
+/// ObjC interop can both introduce subclasses the summaries never saw.
 static bool isKnownFinalClass(ClassDecl *cd, SILModule &module,
                               ClassHierarchyAnalysis *cha) {
   if (cd->isFinal())
@@ -2052,6 +2052,20 @@ GenericFuncSpecializer::GenericFuncSpecializer(
 }
 
 /// Return an existing specialization if one exists.
+/// Look for an existing specialization under the mangled specialized name
+/// before cloning a new one.
+///
+/// Two reuse paths exist today: the current module (including functions
+/// already de-serialized into it), and serialized specializations in
+/// imported modules, which cross-module optimization and exported
+/// @_specialize attributes make visible by name. Both key purely on the
+/// mangled name, which encodes the original function and the substitution
+/// map. There is deliberately no third, process-external cache of cloned
+/// bodies: a SIL function body is only meaningful relative to the
+/// ASTContext and SILModule that produced it (types, conformances,
+/// availability, and shared-linkage siblings it references), so sharing
+/// bodies across independent frontend jobs is the serialized-module
+/// mechanism above, not a side-channel keyed on body hashes.
 SILFunction *GenericFuncSpecializer::lookupSpecialization() {
   SILFunction *SpecializedF = M.lookUpFunction(ClonedName);
   if (!SpecializedF) {
@@ -46,6 +46,12 @@
 /// on it. Many kinds of analysis can be then formulated pretty easily as SQL
 /// queries.
 ///
+/// Pass-effectiveness questions ("which passes run but change nothing on
+/// our code?") fall out of the same dump: every line carries the transform
+/// name and pass number alongside the counter delta, so grouping by
+/// transform and filtering for zero deltas ranks candidates for pruning
+/// from a pipeline — no full-SIL diffing required.
+///
 /// The output format is a set of CSV (comma separated values) lines. Each lines
 /// represents one counter or one counter change.
 ///
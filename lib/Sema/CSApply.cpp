@@ -9655,6 +9655,17 @@ ConstraintSystem::applySolution(Solution &solution,
     }
   }
 
+  // Remember which overloads operator disjunctions committed to, so the
+  // solver can explore those choices first in later expressions.
+  for (const auto &overload : solution.overloadChoices) {
+    auto *decl = overload.second.choice.getDeclOrNull();
+    if (!decl)
+      continue;
+    if (decl->isOperator())
+      getASTContext().recordSolvedOperatorOverload(decl->getBaseIdentifier(),
+                                                   decl);
+  }
+
   ExprRewriter rewriter(*this, solution, target, shouldSuppressDiagnostics());
   ExprWalker walker(rewriter);
   auto resultTarget = walker.rewriteTarget(target);
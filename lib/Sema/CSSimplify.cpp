@@ -6590,6 +6590,49 @@ ConstraintSystem::TypeMatchResult
 ConstraintSystem::matchTypes(Type type1, Type type2, ConstraintKind kind,
                              TypeMatchOptions flags,
                              ConstraintLocatorBuilder locator) {
+  // If both types are fully resolved, the outcome of the match cannot
+  // depend on the state of the current solver branch, so a failed match is
+  // going to fail in every other branch that attempts it as well. Remember
+  // such failures and fail subsequent attempts immediately, which flattens
+  // the repeated structural recursion performed while attempting the
+  // choices of heavily overloaded operator disjunctions.
+  //
+  // This is only sound when fixes are disabled: with fixes enabled a
+  // failing match mutates the system by recording a fix, and the result
+  // depends on which fixes were already recorded. Successful matches are
+  // never remembered, since they may record conversion restrictions that
+  // each branch must rediscover for itself. The match is position dependent
+  // even for concrete types - e.g. the implicit Double<->CGFloat conversion
+  // succeeds at argument positions but is rejected inside an optional
+  // payload - so the locator has to be part of the key; a failure recorded
+  // at one position says nothing about any other.
+  auto isMemoizable = [&](Type type) {
+    return !type->hasTypeVariable() && !type->hasUnresolvedType() &&
+           !type->hasPlaceholder() && !type->hasDependentMember();
+  };
+
+  if (shouldAttemptFixes() || !isMemoizable(type1) || !isMemoizable(type2))
+    return matchTypesImpl(type1, type2, kind, flags, locator);
+
+  auto key = std::make_pair(
+      std::make_pair(type1.getPointer(), type2.getPointer()),
+      std::make_pair(static_cast<unsigned>(kind) | (flags.toRaw() << 8),
+                     getConstraintLocator(locator)));
+
+  if (FailedTypeMatches.count(key))
+    return getTypeMatchFailure(locator);
+
+  auto result = matchTypesImpl(type1, type2, kind, flags, locator);
+  if (result.isFailure())
+    FailedTypeMatches.insert(key);
+
+  return result;
+}
+
+ConstraintSystem::TypeMatchResult
+ConstraintSystem::matchTypesImpl(Type type1, Type type2, ConstraintKind kind,
+                                 TypeMatchOptions flags,
+                                 ConstraintLocatorBuilder locator) {
   auto origType1 = type1;
   auto origType2 = type2;
 
@@ -2255,6 +2255,7 @@ void DisjunctionChoiceProducer::partitionDisjunction(
   // First collect some things that we'll generally put near the beginning or
   // end of the partitioning.
   SmallVector<unsigned, 4> favored;
+  SmallVector<unsigned, 4> previouslySolved;
   SmallVector<unsigned, 4> everythingElse;
   SmallVector<unsigned, 4> simdOperators;
   SmallVector<unsigned, 4> disabled;
@@ -2281,6 +2282,24 @@ void DisjunctionChoiceProducer::partitionDisjunction(
     return false;
   });
 
+  // Then choices matching overloads that operator disjunctions elsewhere in
+  // this module already committed to; identical operator uses tend to
+  // resolve the same way, so explore those first.
+  if (isOperatorDisjunction(Disjunction)) {
+    auto solved = CS.getASTContext().getSolvedOperatorOverloads(
+        Choices[0]->getOverloadChoice().getName().getBaseIdentifier());
+    if (!solved.empty()) {
+      forEachChoice(Choices, [&](unsigned index, Constraint *constraint) -> bool {
+        auto *decl = constraint->getOverloadChoice().getDeclOrNull();
+        if (decl && llvm::is_contained(solved, decl)) {
+          previouslySolved.push_back(index);
+          return true;
+        }
+        return false;
+      });
+    }
+  }
+
   // Then unavailable constraints if we're skipping them.
   if (!CS.shouldAttemptFixes()) {
     forEachChoice(Choices, [&](unsigned index, Constraint *constraint) -> bool {
@@ -2330,6 +2349,7 @@ void DisjunctionChoiceProducer::partitionDisjunction(
       };
 
   appendPartition(favored);
+  appendPartition(previouslySolved);
   appendPartition(everythingElse);
   appendPartition(simdOperators);
   appendPartition(unavailable);
@@ -50,6 +50,9 @@ ConstraintGraph::~ConstraintGraph() {
     delete impl.getGraphNode();
     impl.setGraphNode(nullptr);
   }
+
+  for (auto *node : FreeNodes)
+    delete node;
 }
 
 #pragma mark Graph accessors
@@ -65,8 +68,15 @@ ConstraintGraph::lookupNode(TypeVariableType *typeVar) {
     return { *nodePtr, impl.getGraphIndex() };
   }
 
-  // Allocate the new node.
-  auto nodePtr = new ConstraintGraphNode(*this, typeVar);
+  // Allocate the new node, recycling one released by removeNode if possible.
+  ConstraintGraphNode *nodePtr;
+  if (!FreeNodes.empty()) {
+    nodePtr = FreeNodes.back();
+    FreeNodes.pop_back();
+    nodePtr->reset(typeVar);
+  } else {
+    nodePtr = new ConstraintGraphNode(*this, typeVar);
+  }
   unsigned index = TypeVariables.size();
   impl.setGraphNode(nodePtr);
   impl.setGraphIndex(index);
@@ -111,6 +121,16 @@ ConstraintGraphNode::getEquivalenceClassUnsafe() const{
 
 #pragma mark Node mutation
 
+void ConstraintGraphNode::reset(TypeVariableType *typeVar) {
+  TypeVar = typeVar;
+  Bindings.reset();
+  Constraints.clear();
+  ConstraintIndex.clear();
+  ReferencedBy.clear();
+  References.clear();
+  EquivalenceClass.clear();
+}
+
 static bool isUsefulForReferencedVars(Constraint *constraint) {
   switch (constraint->getKind()) {
     // Don't attempt to propagate information about `Bind`s and
@@ -514,10 +534,10 @@ void ConstraintGraph::Change::undo(ConstraintGraph &cg) {
 #pragma mark Graph mutation
 
 void ConstraintGraph::removeNode(TypeVariableType *typeVar) {
-  // Remove this node.
+  // Remove this node, keeping its storage around for recycling.
   auto &impl = typeVar->getImpl();
   unsigned index = impl.getGraphIndex();
-  delete impl.getGraphNode();
+  FreeNodes.push_back(impl.getGraphNode());
   impl.setGraphNode(nullptr);
 
   // Remove this type variable from the list.
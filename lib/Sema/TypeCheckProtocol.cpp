@@ -1003,6 +1003,9 @@ swift::matchWitness(WitnessChecker::RequirementEnvironmentCache &reqEnvCache,
                     DeclContext *dc, ValueDecl *req, ValueDecl *witness) {
   using namespace constraints;
 
+  FrontendStatsTracer StatsTracer(dc->getASTContext().Stats,
+                                  "match-witness", witness);
+
   // Initialized by the setup operation.
   Optional<ConstraintSystem> cs;
   ConstraintLocator *locator = nullptr;
@@ -4187,6 +4190,16 @@ void ConformanceChecker::checkNonFinalClassWitness(ValueDecl *requirement,
   }
 }
 
+/// Attempt to resolve a witness for the given requirement by looking up
+/// candidate witnesses and matching each one against the requirement.
+///
+/// Note that while the matches for distinct requirements are largely
+/// independent of one another, they cannot be computed concurrently:
+/// matching kicks off evaluator requests, allocates types in the ASTContext
+/// arenas, synthesizes semantic members, and emits diagnostics, none of
+/// which are safe to perform off the main type checking thread. Requirements
+/// are instead matched serially, in the order the protocol declares them,
+/// which also keeps diagnostic output deterministic.
 ResolveWitnessResult
 ConformanceChecker::resolveWitnessViaLookup(ValueDecl *requirement) {
   assert(!isa<AssociatedTypeDecl>(requirement) && "Use resolveTypeWitnessVia*");
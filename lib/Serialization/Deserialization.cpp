@@ -9,6 +9,19 @@
 // See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
 //
 //===----------------------------------------------------------------------===//
+//
+// Everything here runs on the thread that asked for the decl. The access
+// pattern is predictable enough (members after their nominal, witness
+// tables after conformances) that decoding ahead on a helper thread looks
+// tempting, but "decoding" a record is mostly allocating decls in the
+// ASTContext and firing request-evaluator requests, neither of which is
+// thread-safe - a prefetcher limited to the safe part would only be
+// touching mmapped pages the OS readahead already brings in. The cost that
+// matters is AST construction, and it is inherently on-thread; the
+// mitigations for it are the laziness mechanisms below (on-demand member
+// loading, lazy bodies, shortcut tables), not concurrency.
+//
+//===----------------------------------------------------------------------===//
 
 #include "BCReadingExtras.h"
 #include "DeserializationErrors.h"
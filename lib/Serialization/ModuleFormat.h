@@ -2378,6 +2378,17 @@ namespace identifier_block {
 
 /// The record types within the index block.
 ///
+/// Although the container is a bitstream, the hot tables are already
+/// consumed in place from the mmapped file with no up-front decode: the
+/// offset arrays are fixed-width blobs indexed directly by ID, the
+/// identifier data is a raw string blob, and the name-lookup tables are
+/// llvm::OnDiskChainedHashTables probed bucket-by-bucket. The only
+/// sequential bit-level work when opening a module is walking the block
+/// structure to find these blobs, which is proportional to the number of
+/// blocks, not to the module's size. Keep new index records in this
+/// style - one cursor advance to locate a blob, then random access - so
+/// cold module-open cost stays at page faults rather than CPU.
+///
 /// \sa INDEX_BLOCK_ID
 namespace index_block {
   enum RecordKind {
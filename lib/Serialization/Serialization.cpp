@@ -6474,6 +6474,18 @@ SerializerBase::SerializerBase(ArrayRef<unsigned char> signature,
   this->SF = DC.dyn_cast<SourceFile *>();
 }
 
+/// Serialize a module (or source file) to the given stream.
+///
+/// This always writes a complete module from scratch. A delta format -
+/// stable decl IDs with a change journal applied over the previous image -
+/// has been considered for incremental builds and rejected: DeclIDs,
+/// bit offsets, and the various on-disk hash tables are all assigned
+/// densely per emission, so almost any edit renumbers most records, and
+/// readers mmap the file and index into it directly, so they would have to
+/// replay journals on every load. Incrementality is instead provided a
+/// level up, by swiftdeps-driven job skipping (unchanged modules are not
+/// re-serialized at all) and by lazy deserialization on the read side,
+/// which only ever decodes the records a client touches.
 void Serializer::writeToStream(
     raw_ostream &os, ModuleOrSourceFile DC,
     const SILModule *SILMod,
@@ -18,6 +18,7 @@
 #include "swift/AST/ImportCache.h"
 #include "swift/AST/ModuleDependencies.h"
 #include "swift/Basic/Defer.h"
+#include "swift/Basic/FileSystem.h"
 #include "swift/Basic/FileTypes.h"
 #include "swift/Basic/Platform.h"
 #include "swift/Basic/STLExtras.h"
@@ -282,7 +283,7 @@ std::error_code SerializedModuleLoaderBase::openModuleDocFileIfPresent(
   ModuleDocPath{BaseName.getName(file_types::TY_SwiftModuleDocFile)};
 
   llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> ModuleDocOrErr =
-    FS.getBufferForFile(ModuleDocPath);
+    swift::vfs::getMemoryMappedFile(FS, ModuleDocPath);
   if (ModuleDocOrErr) {
     *ModuleDocBuffer = std::move(*ModuleDocOrErr);
   } else if (ModuleDocOrErr.getError() !=
@@ -322,12 +323,13 @@ SerializedModuleLoaderBase::openModuleSourceInfoFileIfPresent(
 
   // Try to open the module source info file from the "Project" directory.
   llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>>
-  ModuleSourceInfoOrErr = FS.getBufferForFile(PathWithProjectDir);
+  ModuleSourceInfoOrErr = swift::vfs::getMemoryMappedFile(FS, PathWithProjectDir);
 
   // If it does not exist, try to open the module source info file adjacent to
   // the .swiftmodule file.
   if (ModuleSourceInfoOrErr.getError() == std::errc::no_such_file_or_directory)
-    ModuleSourceInfoOrErr = FS.getBufferForFile(PathWithoutProjectDir);
+    ModuleSourceInfoOrErr =
+        swift::vfs::getMemoryMappedFile(FS, PathWithoutProjectDir);
 
   // If we ended up with a different file system error, return it.
   if (ModuleSourceInfoOrErr)
@@ -365,10 +367,9 @@ std::error_code SerializedModuleLoaderBase::openModuleFile(
 
   // Actually load the file and error out if necessary.
   //
-  // Use the default arguments except for IsVolatile that is set by the
-  // frontend option -enable-volatile-modules. If set, we avoid the use of
-  // mmap to workaround issues on NFS when the swiftmodule file loaded changes
-  // on disk while it's in use.
+  // IsVolatile is set by the frontend option -enable-volatile-modules. If
+  // set, we avoid the use of mmap to workaround issues on NFS when the
+  // swiftmodule file loaded changes on disk while it's in use.
   //
   // In practice, a swiftmodule file can chane when a client uses a
   // swiftmodule file from a framework while the framework is recompiled and
@@ -379,12 +380,18 @@ std::error_code SerializedModuleLoaderBase::openModuleFile(
   // the surface look like memory corruption.
   //
   // rdar://63755989
+  //
+  // The buffer is opened without requiring a null terminator: the
+  // bitstream reader never runs off the end, and demanding a terminator
+  // forces a private in-memory copy whenever the file size is an exact
+  // multiple of the page size. Keeping the buffer mmap-eligible matters
+  // beyond this process, too, since every concurrent frontend job mapping
+  // the same swiftmodule shares one set of physical pages through the
+  // OS page cache instead of each holding its own copy.
   bool enableVolatileModules = Ctx.LangOpts.EnableVolatileModules;
   llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> ModuleOrErr =
-      FS.getBufferForFile(ModulePath,
-                          /*FileSize=*/-1,
-                          /*RequiresNullTerminator=*/true,
-                          /*IsVolatile=*/enableVolatileModules);
+      swift::vfs::getMemoryMappedFile(FS, ModulePath,
+                                      /*IsVolatile=*/enableVolatileModules);
   if (!ModuleOrErr)
     return ModuleOrErr.getError();
 
@@ -23,6 +23,20 @@ using namespace swift;
 using namespace symbolgraphgen;
 
 namespace {
+// A note on memory and parallelism, for whoever profiles a large module
+// here next. Serialization is already streaming: json::OStream writes
+// straight to the output file and never builds a JSON tree. What holds
+// memory proportional to the module is the graph itself - the Symbol and
+// Edge sets plus their USR strings - and that buffering is currently
+// structural, because edges are discovered interleaved with symbols during
+// the walk but must be emitted as a separate JSON array. Bounding memory
+// means emitting symbols as the walker records them and buffering only the
+// (much smaller) edge list; that is a serialize()/recordNode refactor, not
+// an emission-layer change. A worker pool over decl subtrees is off the
+// table in-process: walking touches lazy ASTContext state (request
+// evaluation, generic signature computation) that has no internal locking,
+// so the walk is single-threaded by construction. Parallelism across
+// *modules* is safe and is what doc pipelines should shard on.
 int serializeSymbolGraph(SymbolGraph &SG,
                          const SymbolGraphOptions &Options) {
   SmallString<256> FileName;
@@ -257,6 +257,16 @@ public struct SymbolicatedBacktrace: CustomStringConvertible {
   }
 
   /// Create a symbolicator.
+  ///
+  /// We deliberately build a fresh symbolicator per symbolication rather
+  /// than keeping a process-wide one: the symbolicator is constructed from
+  /// a snapshot of the image list, which `dlopen`/`dlclose` can invalidate
+  /// at any point, and tracking that correctly here would duplicate logic
+  /// the symbolication framework already owns.  Callers doing repeated
+  /// symbolication (samplers, profilers) should pass `useSymbolCache: true`,
+  /// which lets CoreSymbolication share its address-range → symbol data
+  /// through the system's caching daemon instead of re-extracting it from
+  /// each image.
   private static func withSymbolicator<T>(images: [Backtrace.Image],
                                           sharedCacheInfo: Backtrace.SharedCacheInfo?,
                                           useSymbolCache: Bool,
@@ -142,7 +142,13 @@ namespace swift {
 #ifndef SWIFT_STDLIB_SUPPORT_BACK_DEPLOYMENT
 
 // Call directly through to the original implementation when we don't support
-// overrides.
+// overrides.  This branch covers all non-Darwin platforms (see the #undef
+// above), so on Linux the "override check" costs nothing per call: the thunk
+// body is a direct call that the compiler turns into a tail jump, with no
+// section probe, no cached pointer load, and no branch.  Even on Darwin the
+// section lookup happens once per entry point via swift_once; the steady-state
+// residue there is one predicted-null test, which is the price of the
+// back-deployment mechanism being ABI.
 #define COMPATIBILITY_OVERRIDE(name, ret, attrs, ccAttrs, namespace,           \
                                typedArgs, namedArgs)                           \
   attrs ccAttrs ret namespace swift_##name COMPATIBILITY_PAREN(typedArgs) {    \
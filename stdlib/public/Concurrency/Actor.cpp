@@ -1070,6 +1070,20 @@ struct JobQueueTraits {
 } // end anonymous namespace
 
 
+// Why one intrusive queue with lazy priority sorting, rather than a
+// segmented per-priority mailbox: the whole mutable actor state must fit
+// in ActiveActorStatus so that enqueue, drain-lock transfer, and priority
+// escalation all commute through a single (double-)word CAS — that is
+// what makes enqueue O(1) and wait-free for senders and lets the runtime
+// escalate a running drainer in place. Per-priority heads would not fit
+// in the DefaultActor's fixed PrivateData (NumWords_DefaultActor is ABI)
+// and would reintroduce a multi-word consistency problem between the
+// queues and the status word. The sorting cost lives here instead, on
+// the drain side, and only touches the unprocessed prefix pushed since
+// the last drain; jobs already processed are never re-sorted. Observers
+// wanting queue behavior should use the concurrency::trace actor
+// signposts rather than counters baked into this path.
+//
 // Called with the actor drain lock held
 //
 // This function is called when we hit a conflict between preprocessQueue and
@@ -54,6 +54,19 @@ func _unlock(_ ptr: UnsafeRawPointer)
 
 @available(SwiftStdlib 5.1, *)
 extension AsyncStream {
+  // All storage operations run under one short critical section rather
+  // than a lock-free ring buffer for element transport. The lock is not
+  // guarding a queue of elements so much as a rendezvous: each yield must
+  // atomically choose between handing the value to a waiting consumer
+  // continuation, buffering it, or dropping it per the buffering policy —
+  // and report which one happened in its result — while next() must
+  // atomically either take an element or park a continuation, and
+  // termination/cancellation may race with both from any task. A ring
+  // buffer fast path would only cover the case where elements are queued
+  // and nobody is waiting; every handoff to a parked consumer (the common
+  // state for a fast consumer) still needs the full rendezvous, and yield
+  // is allowed from concurrent producers, so the "SPSC" assumption does
+  // not hold for this API.
   internal final class _Storage: @unchecked Sendable {
     typealias TerminationHandler = @Sendable (Continuation.Termination) -> Void
 
@@ -25,6 +25,16 @@
 
 using namespace swift;
 
+// Every read goes to the OS clock; the runtime keeps no cached "recent
+// now" for coarse deadline checks. There is no runtime-owned tick to
+// refresh such a cache from — scheduling belongs to Dispatch or whatever
+// executor the process installed — and a stale timestamp in a concurrency
+// runtime is a correctness hazard for exactly the deadline code that
+// would consume it. The monotonic reads below are vDSO/commpage calls on
+// the platforms we care about, not syscalls, so the cache would be
+// saving a few nanoseconds at the cost of an unbounded error. Code that
+// genuinely tolerates millisecond granularity can adopt a custom Clock
+// conformance and do its own caching with a policy it controls.
 SWIFT_EXPORT_FROM(swift_Concurrency)
 SWIFT_CC(swift)
 void swift_get_time(
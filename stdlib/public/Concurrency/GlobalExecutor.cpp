@@ -90,6 +90,16 @@ SWIFT_CC(swift)
 void (*swift::swift_task_enqueueMainExecutor_hook)(
     Job *job, swift_task_enqueueMainExecutor_original original) = nullptr;
 
+// The runtime ships exactly these three backends and no bespoke thread
+// pool. The cooperative executor is single-threaded on purpose (it backs
+// the single-threaded concurrency runtime), Dispatch supplies the
+// multi-threaded scheduler where it exists, and everything else is a
+// stub. A scheduler with different policy — per-core deques, stealing,
+// custom park/unpark — should be installed through the
+// swift_task_enqueueGlobal_hook family below, which exists precisely so
+// server runtimes can own that policy without forking the runtime or
+// waiting on its release cycle. Keeping scheduling policy out of this
+// file is what keeps job enqueue ABI-stable across all of them.
 #if SWIFT_CONCURRENCY_COOPERATIVE_GLOBAL_EXECUTOR
 #include "CooperativeGlobalExecutor.inc"
 #elif SWIFT_CONCURRENCY_ENABLE_DISPATCH
@@ -587,6 +587,17 @@ static inline bool taskIsDetached(TaskCreateFlags createFlags, JobFlags jobFlags
   return taskIsUnstructured(createFlags, jobFlags) && !createFlags.copyTaskLocals();
 }
 
+// Task allocations are not poolable as pre-initialized shells: as the
+// accounting below shows, the size is a function of the task's shape —
+// which fragments it carries, the future result type's layout, and the
+// entry point's initial context size — so a fixed-size pool serves only
+// one (shape, result layout) combination and everything else falls back
+// anyway. Nearly all of the "initialization" on the spawn path writes
+// fields that differ per task (parent links, flags, result type, resume
+// function), which a pop-and-patch scheme would still have to write. The
+// spawn patterns hot enough to care about already skip malloc entirely:
+// async-let children draw from the parent's task allocator and
+// run-inline tasks use the caller's buffer (see swift_task_create_common).
 static std::pair<size_t, size_t> amountToAllocateForHeaderAndTask(
     const AsyncTask *parent, const TaskGroup *group,
     const Metadata *futureResultType, size_t initialContextSize) {
@@ -1430,6 +1441,19 @@ static void swift_continuation_awaitImpl(ContinuationAsyncContext *context) {
   return context->ResumeParent(context);
 }
 
+// On the question of resuming the task inline when the resumer is
+// already on the right executor ("symmetric transfer"), which would save
+// the enqueue/dequeue round trip on callback-bridged completions: the
+// Pending case below already achieves it for free — if resume arrives
+// before the awaiting side suspends, we only flip the status word and the
+// awaiter carries on without ever enqueueing. Once the task has actually
+// suspended, inline resumption would run arbitrary async work on the
+// resumer's stack and thread. Resumers are typically foreign callbacks
+// that must return promptly and have not donated their thread; and if the
+// resumer is itself a task, the thread would be running two tasks without
+// the drain-lock and status-word handoff that everything from escalation
+// to task-local storage assumes. The enqueue is what keeps resumption a
+// scheduling event rather than a reentrancy hazard.
 static void resumeTaskAfterContinuation(AsyncTask *task,
                                         ContinuationAsyncContext *context) {
   continuationChecking::willResume(context);
@@ -15,6 +15,18 @@
 // Because allocation is task-local, and there's at most one thread
 // running a task at once, no synchronization is required.
 //
+// Slab lifetime is tied to the task rather than recycled through a
+// per-thread pool across tasks. The short-lived-task case is handled
+// further upstream: async-let children carve their initial slab out of
+// the parent's allocator and run-inline tasks use the caller-provided
+// buffer, so neither touches malloc for slabs at all, and other tasks
+// only malloc a slab once they outgrow what task creation set aside.
+// A cross-task pool would have to cope with tasks resuming on different
+// threads than they suspended on — freeing into a pool the slab was not
+// taken from — which is the remote-free problem the system allocator's
+// own caches already solve, with trimming policy and memory-pressure
+// integration we would otherwise have to reinvent.
+//
 //===----------------------------------------------------------------------===//
 
 #include "swift/Runtime/Concurrency.h"
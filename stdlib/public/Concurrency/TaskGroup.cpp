@@ -302,6 +302,16 @@ protected:
   void unlock() const {}
 #else
   // TODO: move to lockless via the status atomic (make readyQueue an mpsc_queue_t<ReadyQueueItem>)
+  //
+  // Note that the scalable fix for large fan-outs is the MPSC queue above,
+  // not batching completions in thread-local lists before merging: children
+  // complete on whatever executor thread happens to run them, so a local
+  // list has no defined owner left to flush it when that thread moves on,
+  // and holding completions back would delay results that a consumer
+  // already suspended in next() is entitled to see immediately. Per-child
+  // waiter wakeups are not the serialization point either — offer() only
+  // resumes a task when one is actually parked in waitQueue; otherwise it
+  // just links the result and updates status.
   mutable std::mutex mutex_;
 
   void lock() const { mutex_.lock(); }
@@ -736,6 +736,17 @@ static void performEscalationAction(TaskStatusRecord *record,
   // FIXME: allow dynamic extension/correction?
 }
 
+// Cost model for escalating through a dependency chain: each hop is one
+// CAS on that task's status word plus a walk of its own status records
+// under the per-task record lock — there is no global lock anywhere on
+// this path, and a chain of N awaits costs N such hops because the boost
+// genuinely has to reach each blocked task. The price stays amortized
+// because of the first check below: any task whose stored priority is
+// already at or above the boost terminates the recursion immediately, so
+// re-escalations at the same QoS stop at the first hop and a chain is
+// only ever walked once per distinct priority it's raised to. Latency
+// spikes on deep chains are therefore first-escalation cost, paid
+// exactly when the inversion exists and proportional to its depth.
 SWIFT_CC(swift)
 JobPriority
 static swift_task_escalateImpl(AsyncTask *task, JobPriority newPriority) {
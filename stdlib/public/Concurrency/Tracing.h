@@ -112,6 +112,18 @@ void job_run_end(job_run_info info);
 } // namespace concurrency
 } // namespace swift
 
+// The functions above are the complete observation surface of the
+// concurrency runtime: every enqueue, dequeue, state change, wait, and
+// run span already flows through them. They are deliberately an internal
+// header-level seam rather than public ABI — the call sites compile to
+// nothing when tracing is disabled, and the signatures can follow the
+// runtime's internals without deprecation cost. A non-Darwin backend
+// (counters, LTTng/USDT probes, a shared-memory stats page) belongs
+// behind this same seam as an alternative to TracingStubs.h, selected at
+// stdlib build time like the signpost backend below. What should not
+// happen is exporting these as a stable runtime API for processes to
+// register callbacks against: that freezes internal details and puts
+// third-party code on the hottest paths in the runtime.
 #if SWIFT_STDLIB_CONCURRENCY_TRACING
 #include "TracingSignpost.h"
 #else
@@ -36,7 +36,7 @@ extension CxxRandomAccessCollection {
     return Int(__endUnsafe() - __beginUnsafe())
   }
 
-  /// A C++ implementation of the subscript might be more performant. This 
+  /// A C++ implementation of the subscript might be more performant. This
   /// overload should only be used if the C++ type does not define `operator[]`.
   @inlinable
   public subscript(_ index: Int) -> Element {
@@ -48,3 +48,44 @@ extension CxxRandomAccessCollection {
     }
   }
 }
+
+extension CxxRandomAccessCollection where RawIterator == UnsafePointer<Element> {
+  /// Calls the given closure with a buffer pointer viewing the contiguous
+  /// storage of the C++ container.
+  ///
+  /// This is a zero-copy view: no elements are copied or converted. It is
+  /// only available when the container's iterators are raw pointers (e.g.
+  /// `std::span`, `std::array`, and many custom containers), which
+  /// guarantees the storage is contiguous.
+  ///
+  /// The buffer pointer is only valid for the duration of `body`. The caller
+  /// must ensure the C++ container is not mutated or destroyed while `body`
+  /// executes; Swift cannot enforce this for C++ storage.
+  @inlinable
+  public func withUnsafeBufferPointer<Result>(
+    _ body: (UnsafeBufferPointer<Element>) throws -> Result
+  ) rethrows -> Result {
+    let begin = __beginUnsafe()
+    let count = Int(__endUnsafe() - begin)
+    return try withExtendedLifetime(self) {
+      try body(UnsafeBufferPointer(start: begin, count: count))
+    }
+  }
+}
+
+extension Array {
+  /// Creates an array containing the elements of a contiguous C++ container.
+  ///
+  /// Unlike the generic `RangeReplaceableCollection` initializer, which
+  /// appends element by element, this initializer copies the container's
+  /// storage with a single bulk copy.
+  ///
+  /// - Complexity: O(*n*), where *n* is the number of elements in the C++
+  ///   container, with a single allocation and a contiguous copy.
+  @inlinable
+  public init<C: CxxRandomAccessCollection>(_ elements: C)
+    where C.RawIterator == UnsafePointer<Element> {
+
+    self = elements.withUnsafeBufferPointer { Array($0) }
+  }
+}
@@ -20,24 +20,22 @@ extension std.string {
   /// - Complexity: O(*n*), where *n* is the number of UTF-8 code units in the
   ///   Swift string.
   public init(_ string: String) {
-    self.init()
-    for char in string.utf8 {
-      self.push_back(value_type(bitPattern: char))
+    // Use the (pointer, length) C++ constructor so the contents transfer as
+    // one bulk copy instead of a push_back per byte. For the short ASCII
+    // strings that dominate interop boundaries this lands directly in the
+    // C++ small-string buffer without touching the heap.
+    self = string.withCString { buffer in
+      std.string(buffer, string.utf8.count)
     }
   }
 
   public init(_ string: UnsafePointer<CChar>?) {
-    self.init()
-
     guard let str = string else {
+      self.init()
       return
     }
 
-    let len = UTF8._nullCodeUnitOffset(in: str)
-    for i in 0..<len {
-      let char = UInt8(str[i])
-      self.push_back(value_type(bitPattern: char))
-    }
+    self.init(str, UTF8._nullCodeUnitOffset(in: str))
   }
 }
 
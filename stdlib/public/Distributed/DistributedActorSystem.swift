@@ -699,6 +699,13 @@ func _executeDistributedTarget<D: DistributedTargetInvocationDecoder>(
 /// on the caller's task, and if any smarter encoding can be used once all parameter calls have been
 /// recorded (e.g. it may be possible to run-length encode values of certain types etc.)
 ///
+/// The `record...` calls receive each argument at its concrete type, without any
+/// intermediate boxing performed by the runtime. An encoder aiming for zero-copy
+/// operation is therefore free to serialize each value directly into transport-owned
+/// contiguous buffers (e.g. scatter/gather segments handed to a vectored write) as
+/// the calls arrive; whether any temporary allocation happens is entirely a property
+/// of the serialization mechanism the adopting system chooses, not of this protocol.
+///
 /// Once encoded, the system should use some underlying transport mechanism to send the
 /// bytes serialized by the invocation to the remote peer.
 ///
@@ -50,6 +50,17 @@ public struct ObservationRegistrar: Sendable {
       }
     }
     
+    // Notification here is already coalesced by construction: observations
+    // are one-shot, so the first mutated property that matches an
+    // observation fires it and cancels it, and further mutations in the
+    // same transaction find nothing to deliver. What cannot be batched is
+    // the callout itself — the API contract is that the observer runs
+    // before the mutation (willSet timing), which UI frameworks rely on to
+    // snapshot the old value. Deferring callouts into a thread-local
+    // pending set flushed at transaction end would move them after the
+    // write and change observable behavior. The read side needs no such
+    // treatment: `access` records into a per-thread _AccessList and never
+    // takes this lock.
     mutating func willSet(keyPath: AnyKeyPath) -> [@Sendable () -> Void] {
       var observers = [@Sendable () -> Void]()
       if let ids = lookups[keyPath] {
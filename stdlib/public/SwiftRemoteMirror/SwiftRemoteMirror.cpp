@@ -26,6 +26,7 @@ SWIFT_REMOTE_MIRROR_LINKAGE uint32_t swift_reflection_libraryVersion = 3;
 #include "swift/RemoteInspection/ReflectionContext.h"
 #include "swift/RemoteInspection/TypeLowering.h"
 #include "swift/Remote/CMemoryReader.h"
+#include "swift/Remote/CachingMemoryReader.h"
 #include "swift/Basic/Unreachable.h"
 
 #if defined(__APPLE__) && defined(__MACH__)
@@ -45,14 +46,22 @@ using NativeReflectionContext = swift::reflection::ReflectionContext<Runtime>;
 
 struct SwiftReflectionContext {
   NativeReflectionContext *nativeContext;
+  /// The reader the native context reads through. Metadata reconstruction
+  /// issues many small reads with strong spatial locality, and every one of
+  /// them crosses the client's ReadBytes callback (often a syscall or RPC per
+  /// call), so the client's reader is wrapped in a page cache. The cache is
+  /// flushed from the entry points that imply the inferior has run; see
+  /// swift_reflection_addImage.
+  std::shared_ptr<CachingMemoryReader> reader;
   std::vector<std::function<void()>> freeFuncs;
   std::vector<std::tuple<swift_addr_t, swift_addr_t>> dataSegments;
 
   std::function<void(void)> freeTemporaryAllocation = [] {};
 
   SwiftReflectionContext(MemoryReaderImpl impl) {
-    auto Reader = std::make_shared<CMemoryReader>(impl);
-    nativeContext = new NativeReflectionContext(Reader);
+    reader = std::make_shared<CachingMemoryReader>(
+        std::make_shared<CMemoryReader>(impl));
+    nativeContext = new NativeReflectionContext(reader);
   }
 
   ~SwiftReflectionContext() {
@@ -248,6 +257,8 @@ swift_reflection_addReflectionInfo(SwiftReflectionContextRef ContextRef,
       ReflectionSection<MultiPayloadEnumDescriptorIterator>(0, 0),
       {}};
 
+  // New reflection info implies the inferior has run; drop cached memory.
+  ContextRef->reader->flush();
   Context->addReflectionInfo(ContextInfo);
 }
 
@@ -271,6 +282,8 @@ void swift_reflection_addReflectionMappingInfo(
       MultiPayloadEnumSection(0, 0),
       {}};
 
+  // New reflection info implies the inferior has run; drop cached memory.
+  ContextRef->reader->flush();
   Context->addReflectionInfo(ContextInfo);
 }
 
@@ -278,6 +291,9 @@ int
 swift_reflection_addImage(SwiftReflectionContextRef ContextRef,
                           swift_addr_t imageStart) {
   auto Context = ContextRef->nativeContext;
+  // A new image means the inferior has run since we last looked at it, so
+  // any cached memory may be stale.
+  ContextRef->reader->flush();
   return Context->addImage(RemoteAddress(imageStart)).has_value();
 }
 
@@ -109,6 +109,25 @@ typedef InlineRefCountsPlaceholder InlineRefCounts;
   Upside: this code has less duplication than it might otherwise
 
 
+  Why not biased (thread-owned) reference counting:
+
+  The recurring proposal is a non-atomic fast path owned by the allocating
+  thread, inflating to atomic on first cross-thread access. It does not fit
+  this layout or this runtime. The inline bits have no room for an owner
+  thread ID without evicting the strong count to the side table, which
+  trades the common case's single RMW for a dependent load plus RMW.
+  Detecting "first cross-thread access" requires every retain/release on
+  every thread to check ownership before choosing the non-atomic path, and
+  inflation must interrupt an owner that may be mid non-atomic
+  read-modify-write — the published schemes do this with signals or
+  safepoint handshakes, neither of which the Swift runtime has or wants.
+  ObjC interop makes it worse: retains arriving via objc_retain on bridged
+  objects would also need the ownership check. The static version of the
+  same bet already exists: when SIL proves a reference never escapes its
+  thread, the compiler emits swift_nonatomic_retain/release and skips the
+  atomics with no per-object state at all.
+
+
   Object lifecycle state machine:
 
   LIVE without side table
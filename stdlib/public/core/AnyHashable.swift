@@ -136,6 +136,18 @@ internal struct _ConcreteHashableBox<Base: Hashable>: _AnyHashableBox {
 /// two releases of the standard library.
 @frozen
 public struct AnyHashable {
+  // Performance note: despite the "box" name, wrapping a small value does
+  // not heap-allocate. `_box` is an existential, and `_ConcreteHashableBox`
+  // is a struct, so payloads up to three words - Int, Double, String -
+  // live in the existential's inline buffer; only larger values spill to a
+  // heap copy. Hashing and equality cost one protocol-witness call each.
+  // A tag-checked inline fast path for "known" key types would put an
+  // extra branch ahead of every operation for all types, and the tag would
+  // become ABI the stdlib must carry forever; with the inline buffer
+  // already eliminating the allocation, the witness call is not worth
+  // buying back at that price. Keys showing up hot in profiles are better
+  // served by using a concretely typed Dictionary, which skips AnyHashable
+  // altogether.
   internal var _box: _AnyHashableBox
 
   internal init(_box box: _AnyHashableBox) {
@@ -16,6 +16,18 @@
 /// Because `_UnsafeBitset` implements a flat bit vector, it isn't suitable for
 /// holding arbitrarily large integers. The maximal element a bitset can store
 /// is fixed at its initialization.
+///
+/// This type is intentionally not the seed of a public `BitArray`. It is
+/// unsafe (unmanaged storage, caller-provided lifetime) and shaped purely
+/// around what the Set/Dictionary machinery needs; a general bit vector
+/// wants managed storage, resizing, bitwise operators, and ranged mutation,
+/// all of which are API commitments the stdlib would carry as frozen ABI.
+/// That design space belongs to the swift-collections package's `BitArray`,
+/// which iterates outside the ABI boundary and already provides the
+/// word-parallel operations. `Word` below is self-contained, though - if
+/// you need the bit-manipulation core (popcount via `count`,
+/// first-set-bit via `minimum`, set-bit iteration) over your own storage,
+/// it transplants cleanly.
 @frozen
 @usableFromInline // @testable
 internal struct _UnsafeBitset {
@@ -300,6 +300,16 @@ internal struct _ContiguousArrayBuffer<Element>: _ArrayBufferProtocol {
          realMinimumCapacity._builtinWordValue, Element.self)
 
       let storageAddr = UnsafeMutableRawPointer(Builtin.bridgeToRawPointer(_storage))
+      // Claiming the full malloc block here is also why there's no
+      // realloc-style growth path: any in-place headroom the allocator
+      // would hand back already became capacity when the buffer was
+      // created, so growth only happens when the block is genuinely
+      // exhausted. At that point realloc is allowed to move the block,
+      // and array storage is a live Swift object — its address is its
+      // identity for uniqueness checks and any side-table entries — so a
+      // moving realloc is unsound, and no platform we support exposes a
+      // portable expand-in-place-or-fail call. Repeated multi-megabyte
+      // regrowth is what reserveCapacity is for.
       if let allocSize = _mallocSize(ofAllocation: storageAddr) {
         let endAddr = storageAddr + allocSize
         let realCapacity = endAddr.assumingMemoryBound(to: Element.self) - firstElementAddress
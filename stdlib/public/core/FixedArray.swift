@@ -12,6 +12,17 @@
 //
 //  A helper struct to provide fixed-sized array like functionality
 //
+//  This is the stdlib's internal answer to small bounded collections that
+//  must not touch the allocator: storage is an inline tuple, so a
+//  _FixedArray16 lives wherever its owner lives (stack, register split, or
+//  enclosing struct) with no ContiguousArrayBuffer, refcounting, or
+//  uniqueness checks. It is deliberately internal and deliberately
+//  hardcoded at 16: a public InlineArray<N, Element> needs the element
+//  count as a generic parameter, and the generics system has no value
+//  parameters today - a family of _FixedArray1...N types would each be
+//  permanent ABI. When a capacity other than 16 is really needed, the
+//  tuple-plus-count pattern here is small enough to replicate.
+//
 //===----------------------------------------------------------------------===//
 
 internal struct _FixedArray16<T> {
@@ -16,6 +16,18 @@ internal protocol _HashTableDelegate {
   func moveEntry(from source: _HashTable.Bucket, to target: _HashTable.Bucket)
 }
 
+/// The bucket layout here — an occupancy bitset plus separate key/value
+/// arrays, probed linearly one bucket at a time — periodically draws
+/// comparisons to flat control-byte designs (SwissTable: a contiguous
+/// 1-byte tag array probed 16 buckets at a time with vector compares).
+/// That layout genuinely saves cache misses on large miss-heavy tables,
+/// but it is not reachable from here by refactoring: this struct is
+/// frozen and the probe loops are inlinable, so the bitset layout and
+/// probing scheme are compiled into shipped client binaries and must keep
+/// working against the storage the stdlib allocates. Changing the storage
+/// format is an ABI break with every deployed app, not an internal swap.
+/// Within the current format, note that a probe touches the bitset word
+/// and the key array only; hash control bytes don't exist to re-check.
 @usableFromInline
 @frozen
 internal struct _HashTable {
@@ -274,6 +274,17 @@ extension Hasher {
 ///   different values on every new execution of your program. The hash
 ///   algorithm implemented by `Hasher` may itself change between any two
 ///   versions of the standard library.
+// On requests for a selectable faster algorithm for trusted workloads:
+// the algorithm isn't a swappable implementation detail. Hasher is frozen
+// and its combine paths inline into client binaries, so the choice is
+// baked into compiled code; a process-level mode switch would make hash
+// values differ between code inlined before and after the switch; and a
+// per-table algorithm can't be expressed because tables don't hash —
+// Hashable types do, through whatever Hasher they're handed. SipHash-1-3
+// is already the concession to speed over the full-strength 2-4 variant.
+// For keys where that still dominates, the supported escape hatch is a
+// custom hashValue/Hashable implementation on the key type (accepting
+// responsibility for collision behavior), not a second stdlib algorithm.
 @frozen // FIXME: Should be resilient (rdar://problem/38549901)
 public struct Hasher {
   internal var _core: _Core
@@ -316,7 +316,17 @@ public class KeyPath<Root, Value>: PartialKeyPath<Root> {
   
   @usableFromInline
   internal final func _projectReadOnly(from root: Root) -> Value {
-      
+
+    // Repeated applications of the same key path are the common hot case
+    // (e.g. generic encoders applying a fixed set of paths per record).
+    // For paths made purely of stored struct properties, instantiation
+    // already "compiles" the whole component list down to a single byte
+    // offset cached on the object (see assignOffsetToStorage), so the
+    // fast path below is one pointer add per application. Any path with a
+    // computed component, optional chain, or class hop cannot be flattened
+    // further: its cost is the accessor calls themselves, which a cached
+    // "program" would still have to make in the same order.
+
     // One performance improvement is to skip right to Value
     // if this keypath traverses through structs only.
     if let offset = getOffsetFromStorage() {
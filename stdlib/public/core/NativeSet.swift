@@ -739,6 +739,15 @@ extension _NativeSet {
   internal __consuming func intersection(
     _ other: _NativeSet<Element>
   ) -> _NativeSet<Element> {
+    // Bucket-level bulk merging ("both operands share seed and layout, so
+    // walk the buckets in lockstep and reuse stored hashes") is not an
+    // available shortcut in this design, for two structural reasons: the
+    // table stores no hash codes — only the occupancy bitset and the
+    // elements — so there is nothing stored to reuse; and seeds are
+    // per-storage-allocation (see _HashTable.hashSeed), so two
+    // independently populated sets never agree on bucket positions. Only
+    // CoW copies of one table share a layout, and those are equal sets.
+    //
     // Rather than directly creating a new set, mark common elements in a
     // bitset first. This minimizes hashing, and ensures that we'll have an
     // exact count for the result set, preventing rehashings during
@@ -172,6 +172,17 @@ where Self: RandomAccessCollection, Element: Comparable {
   }
 }
 
+// A parallel sort entry point can't live in this file, independent of
+// whether one is wanted: the core library sits below the concurrency
+// runtime in the layering, so nothing here can spawn a task group or
+// touch an executor, and threads are not something the core stdlib may
+// create on its own. A `parallelSort()` over MutableCollection would
+// also be new public API (Swift Evolution territory) with a semantic
+// wrinkle the serial sort doesn't have — `areInIncreasingOrder` closures
+// would run concurrently and would need to be Sendable. Libraries built
+// on top of the stdlib (e.g. over UnsafeMutableBufferPointer chunks with
+// a task group) are the right home for that.
+
 extension MutableCollection where Self: RandomAccessCollection {
   /// Sorts the collection in place, using the given predicate as the
   /// comparison between elements.
@@ -1060,7 +1060,31 @@ extension _StringGutsSlice {
     _guts.withFastUTF8 { utf8 in
       var position = 0
 
+      // ASCII is always NFC with a ccc of 0, so runs of it can be classified
+      // a whole word at a time with a single mask check (same trick as
+      // _allASCII). Mixed-script text is dominated by such runs, leaving the
+      // per-scalar work below for the segments that actually need it.
+      let wordASCIIMask = UInt(truncatingIfNeeded: 0x8080_8080_8080_8080 as UInt64)
+      let wordStride = MemoryLayout<UInt>.stride
+      let address = Int(bitPattern: utf8.baseAddress._unsafelyUnwrappedUnchecked)
+
       while position < utf8.count {
+        if (address &+ position) % wordStride == 0 {
+          var skippedWords = false
+          while position &+ wordStride <= utf8.count {
+            let word: UInt = UnsafePointer(
+              bitPattern: address &+ position
+            )._unsafelyUnwrappedUnchecked.pointee
+            guard word & wordASCIIMask == 0 else { break }
+            position &+= wordStride
+            skippedWords = true
+          }
+          if skippedWords {
+            prevCCC = 0
+            continue
+          }
+        }
+
         // If our first byte is less than 0xCC, then it means we're under the
         // 0x300 scalar value and everything up to 0x300 is NFC already.
         if utf8[position] < 0xCC {
@@ -42,6 +42,15 @@ internal func _stringCompareWithSmolCheck(
   return _stringCompareInternal(lhs, rhs, expecting: expecting)
 }
 
+// Reports of ASCII keys comparing "through the slow path" usually
+// misread this funnel. Native ASCII strings have isNFC set at creation
+// (isASCII implies isNFC), so they reach _stringCompareFastUTF8's
+// bothNFC branch and compare with a single memcmp; hashing has the
+// matching isNFCFastUTF8 bulk path in StringHashable.swift. Strings that
+// genuinely miss these paths are the ones without contiguous UTF-8 to
+// scan — above all lazily-bridged NSStrings on Darwin — and no amount of
+// SIMD here helps them; the fix on that profile is forcing a native copy
+// at the boundary once, not widening this comparison.
 @inline(never) // Keep `_stringCompareWithSmolCheck` fast-path fast
 @usableFromInline
 @_effects(readonly)
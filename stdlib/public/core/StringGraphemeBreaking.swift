@@ -655,6 +655,19 @@ extension _GraphemeBreakingState {
   //
   // This is based on the Unicode Annex #29 for [Grapheme Cluster Boundary
   // Rules](https://unicode.org/reports/tr29/#Grapheme_Cluster_Boundary_Rules).
+  //
+  // A note on compiling all of this into one DFA transition table, which
+  // looks attractive for character-wise iteration over large texts: the
+  // per-pair work here is already one break-property lookup per scalar
+  // plus a jump-table switch, and the property lookup is the expensive
+  // part — a DFA row index is the same lookup wearing a different hat.
+  // What a pure DFA cannot encode is the part that isn't regular over
+  // properties alone: GB11's emoji-ZWJ context, GB12/13's regional
+  // indicator parity, and GB9c's linking-consonant check all consult
+  // extra per-scalar facts or history, which is exactly what this
+  // explicit state struct carries. For text where none of that applies,
+  // _hasGraphemeBreakBetween already answers most pairs before either
+  // property lookup happens.
   internal mutating func shouldBreak(
     between scalar1: Unicode.Scalar,
     and scalar2: Unicode.Scalar
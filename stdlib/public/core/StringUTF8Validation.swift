@@ -31,6 +31,17 @@ extension UTF8ValidationResult: Equatable {}
 
 private struct UTF8ValidationError: Error {}
 
+// The throughput story for this validator: the dominant ingest case,
+// all-ASCII payloads, never reaches the scalar loop below — _allASCII
+// checks a full word per iteration with a straight-line body that LLVM
+// can vectorize for the target. The shuffle-table SIMD validators from
+// the literature (simdjson-style) win on dense multi-byte text, but they
+// depend on byte-shuffle instructions the stdlib cannot assume across
+// every target it builds for, and they classify bytes without producing
+// the exact maximal-subpart error ranges that our repair path
+// (toBeReplaced, per Unicode's substitution rules) must report. Until
+// there's a portable way to get both, the structure here is deliberate:
+// vector-speed ASCII scan, scalar precision for the rest.
 internal func validateUTF8(_ buf: UnsafeBufferPointer<UInt8>) -> UTF8ValidationResult {
   if _allASCII(buf) {
     return .success(UTF8ExtraInfo(isASCII: true))
@@ -27,6 +27,15 @@ private:
   /// The underlying allocator.
   // TODO: Use a custom allocator so that the initial slab can be
   // tail-allocated.
+  //
+  // Note that recycling slabs through a thread-local pool does not work
+  // here: the context is a refcounted heap object, so the last release —
+  // and hence the slab free — can happen on a different thread than the
+  // one that ran the forward pass, and a pool keyed by the allocating
+  // thread would fill with memory it can never safely reuse. Growth cost
+  // is instead amortized by BumpPtrAllocator's slab doubling; the
+  // remaining per-invocation malloc is the initial slab, which the TODO
+  // above would fold into the context allocation itself.
   llvm::BumpPtrAllocator allocator;
 
 public:
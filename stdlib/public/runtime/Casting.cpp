@@ -167,6 +167,12 @@ static LazyMutex MangledToPrettyFunctionNameCacheLock;
 
 /// Cache containing rendered names for Metadata.
 /// Access MUST be protected using `TypeNameCacheLock`.
+///
+/// The cache is unbounded by design, not by oversight: entries hand out
+/// interior pointers through TypeNamePair with no lifetime tokens, so an
+/// entry can never be evicted once returned.  The population is bounded
+/// anyway by the number of distinct metadata the process ever formats,
+/// and each demangling runs exactly once.
 static Lazy<llvm::DenseMap<TypeNameCacheKey, std::pair<const char *, size_t>>>
   TypeNameCache;
 
@@ -1352,6 +1358,15 @@ swift_conformsToObjectiveCBridgeable(const Metadata *T) {
     (swift_conformsToProtocol(T, &PROTOCOL_DESCR_SYM(s21_ObjectiveCBridgeable)));
 }
 
+// This does a conformance lookup per call rather than keeping a
+// type-keyed "bridging plan" cache in front of it. The lookup already
+// bottoms out in the conformance cache's lock-free hash probe for every
+// call after the first per (type, protocol), so a front cache keyed on
+// the metadata pointer would duplicate that table to save one hash of a
+// pointer pair — and it would need its own answer for conformances that
+// appear when images are loaded later. The single type hot enough to
+// deserve a dedicated slot gets one below; resist growing that list
+// without String-sized numbers to justify it.
 static const _ObjectiveCBridgeableWitnessTable *
 findBridgeWitness(const Metadata *T) {
   // Special case: Memoize the bridge witness for Swift.String.
@@ -2552,6 +2552,21 @@ tryCast(
 /******************************************************************************/
 
 /// ABI: Perform a dynamic cast to an arbitrary type.
+///
+/// Per-call-site inline caches (remember the last source type and its
+/// verdict at each cast site) come up periodically for workloads that
+/// repeat the same as?-cast millions of times. They don't fit this
+/// entry point: code patching is off the table on our platforms (code
+/// signing, ptrauth, W^X), and a data-side cache slot would be a new
+/// compiler/runtime ABI whose hit case still can't skip the work with
+/// side effects — bridging, boxing, and ownership transfer depend on the
+/// dynamic value, not just the (srcType, destType) pair. The cheap
+/// repeated cases are already cheap: SILGen emits the specialized
+/// class/metatype entry points when the target is statically known, and
+/// the expensive subpaths here bottom out in the conformance and
+/// metadata caches. Hot cast sites that still hurt are better served by
+/// making the types statically visible to the optimizer than by caching
+/// inside the most general entry point.
 static bool
 swift_dynamicCastImpl(OpaqueValue *destLocation,
                       OpaqueValue *srcValue,
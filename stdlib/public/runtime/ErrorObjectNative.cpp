@@ -64,6 +64,18 @@ static const FullMetadata<HeapMetadata> ErrorMetadata{
   HeapMetadata(MetadataKind::ErrorObject),
 };
 
+// Throw cost here is one size computation (two loads off the value
+// witnesses - there is no per-throw metadata lookup to cache) plus one
+// swift_allocObject. Pooling and recycling boxes per type has been
+// considered and rejected: a box is an ordinary refcounted object that
+// escapes into user code with retain/release-managed lifetime, so reuse
+// would mean hooking final release into per-type free lists guarded
+// against concurrent throwers - rebuilding the magazine layer malloc
+// already provides under swift_allocObject. High-rate control-flow errors
+// are better served on the source side, where the allocation disappears
+// entirely: throw a class-typed error (the instance itself is the error,
+// boxless) or reserve thrown errors for exceptional paths and return
+// Result/enum for expected misses.
 BoxPair
 swift::swift_allocError(const swift::Metadata *type,
                         const swift::WitnessTable *errorConformance,
@@ -153,6 +153,18 @@ static void reportExclusivityConflict(ExclusivityFlags oldAction, void *oldPC,
   _swift_reportToDebugger(RuntimeErrorFlagFatal, message, &details);
 }
 
+// A linear scan of a linked list looks like the naive choice here, but the
+// shape of the problem constrains us. The Access records are fixed-size
+// buffers in the caller's frame whose address is ABI with the compiler, so
+// they cannot be relocated into a contiguous array; at best a side array of
+// pointers could be maintained, which still scans. A hash/Bloom fingerprint
+// word for one-branch rejection only pays off while few accesses are live:
+// bits cannot be cleared on removal (they may be shared), so exactly the
+// deep-stack workloads where the scan hurts are the ones that saturate the
+// filter and then pay for it on top of the scan. In practice the set holds
+// the accesses dynamically active on this thread at one instant, which
+// optimized code keeps small; if it is large, the fix that actually helps
+// is letting the compiler prove more accesses static.
 bool AccessSet::insert(Access *access, void *pc, void *pointer,
                        ExclusivityFlags flags) {
 #ifndef NDEBUG
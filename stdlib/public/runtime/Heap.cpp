@@ -12,6 +12,21 @@
 //
 // Implementations of the Swift heap
 //
+// These entry points bind to malloc on purpose, and there is no hook to
+// install a different allocator at runtime. Routing Swift allocations into
+// a custom allocator (jemalloc, an arena with telemetry) is done the same
+// way as for every other component in the process: replace malloc itself,
+// by linking the allocator or interposing it (LD_PRELOAD, the zone APIs on
+// Darwin). That covers swift_slowAlloc/swift_slowDealloc, the aligned
+// paths below (which sit on malloc/posix_memalign per platform), and
+// MetadataAllocator's backing pools, all at once. An indirection vtable
+// here would buy the same capability at the cost of a load-and-call on the
+// hottest path in the runtime for every process, including the vast
+// majority that never install anything - and it could not be "stable" in
+// the requested sense anyway, because the alignment contract documented
+// below (see _swift_MinAllocationAlignment and MALLOC_ALIGN_MASK) is part
+// of the allocator interface and varies by platform.
+//
 //===----------------------------------------------------------------------===//
 
 #include "swift/Runtime/HeapObject.h"
@@ -78,6 +93,18 @@ static size_t computeAlignment(size_t alignMask) {
                                      : alignMask + 1;
 }
 
+// Heap object allocation goes straight to the system allocator on purpose;
+// there is no runtime-private per-thread size-class cache in front of it.
+// Releases run on whatever thread drops the last reference, so a per-thread
+// magazine needs remote-free queues and flush heuristics — at which point it
+// is a general-purpose allocator, competing with the one the platform already
+// tuned (libmalloc's per-thread caches on Darwin, and on other platforms the
+// allocator is swappable process-wide). Staying in the default zone is also
+// what keeps leaks, heap, Instruments, and the sanitizers able to see and
+// attribute every Swift object. If malloc entry/exit dominates a profile, the
+// leverage is fewer or batched allocations (or, for scoped lifetimes, the
+// task allocator) rather than a second allocator layered here.
+//
 // For alignMask > (_minAllocationAlignment-1)
 // i.e. alignment == 0 || alignment > _minAllocationAlignment:
 //   The runtime must use AlignedAlloc, and the standard library must
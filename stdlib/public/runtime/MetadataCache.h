@@ -210,6 +210,21 @@ public:
 /// A map for which there is a phase of initialization that is guaranteed
 /// to be performed exclusively.
 ///
+/// A note on contention, since this comes up whenever metadata lookup
+/// appears in a startup profile: there is no single global metadata cache
+/// to shard. Each generic type descriptor carries its own instantiation
+/// cache (TargetGenericMetadataInstantiationCache), so distinct types never
+/// contend, and within a cache the underlying ConcurrentReadableHashMap
+/// serves hits from a snapshot without taking the writer lock. The lock and
+/// the wait queues only come into play while an entry is being instantiated,
+/// and many threads requesting the *same* uninstantiated type must serialize
+/// there by design — the instantiation function runs exactly once and
+/// everyone else waits on its result. Sharding by key hash would not change
+/// that. Per-cache contention counters have been considered and rejected:
+/// this structure must fit in the descriptor's PrivateData area, which is
+/// already tight enough on 32-bit targets to force SmallMutex (see
+/// LockingConcurrentMapStorage above).
+///
 /// In addition to the requirements of ConcurrentMap, the entry type must
 /// provide the following members:
 ///
@@ -312,6 +312,17 @@ namespace {
   };
 } // end anonymous namespace
 
+// A compiler-emitted per-image hash section (mangled-name hash ->
+// descriptor) has been suggested as a way to skip the first-miss scans
+// that show up as post-deploy warmup in reflection-heavy processes. The
+// sticking point is the key: the runtime looks up the mangling it
+// *re-derives* from a demangle tree with symbolic references expanded
+// (see _findContextDescriptor), and an on-disk table is only correct if
+// the compiler's byte-for-byte mangling of every record matches what any
+// future runtime reconstructs. That coupling across compiler and runtime
+// versions is a bincompat hazard we have deliberately avoided; symbolic
+// references, the stdlib short-mangling fast path, and NominalCache keep
+// the name-keyed slow path to one scan per distinct name per process.
 struct TypeMetadataPrivateState {
   ConcurrentReadableHashMap<NominalTypeDescriptorCacheEntry> NominalCache;
   ConcurrentReadableArray<TypeMetadataSection> SectionsToScan;
@@ -415,6 +415,21 @@ namespace {
 } // end anonymous namespace
 
 // Conformance Cache.
+//
+// SectionsToScan is deliberately just a list of section bounds, not a
+// per-image hash index built at registration time. Indexing a section up
+// front would require resolving the relative and possibly indirect pointers
+// in every conformance record (descriptor.getProtocol() and the type
+// reference), which faults in and dirties the same pages a miss-path scan
+// would touch — except it does so at image load for every record, including
+// the majority that are never queried. The lazy scan pays that cost only on
+// the first miss per protocol, and its results are captured in Cache keyed
+// by (type, protocol) along with the number of sections scanned, so a given
+// query rescans only when new images have been registered since. Where an
+// ahead-of-time index is genuinely free — the dyld shared cache on Darwin —
+// we already consume it (see USE_DYLD_SHARED_CACHE_CONFORMANCE_TABLES
+// below); the equivalent for other platforms belongs in a build/link-time
+// tool that can emit a sorted table next to the records, not in the runtime.
 struct ConformanceState {
   ConcurrentReadableHashMap<ConformanceCacheEntry> Cache;
   ConcurrentReadableArray<ConformanceSection> SectionsToScan;
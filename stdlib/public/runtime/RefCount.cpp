@@ -100,8 +100,20 @@ HeapObjectSideTableEntry* RefCounts<InlineRefCountBits>::allocateSideTable(bool
   }
 
   // Preflight passed. Allocate a side table.
-  
+
   // FIXME: custom side table allocator
+  //
+  // Before reaching for one, note what this path already is: the allocation
+  // happens at most once per object, installation is a single CAS with the
+  // loser deleting its speculative entry, and the entry is torn down as
+  // soon as the weak count reaches zero (see HeapObjectSideTableEntry's
+  // decrementWeak path) - there is no deferred sweep to batch. An entry is
+  // a handful of words, a size class every malloc keeps in its per-thread
+  // caches, so dedicated magazines would mostly re-implement that layer.
+  // The remaining win a custom allocator could offer is locality: placing
+  // entries for objects that die together on shared cache lines. That
+  // requires knowing the death cohort at allocation time, which the
+  // runtime does not.
   auto side = swift_cxx_newObject<HeapObjectSideTableEntry>(getHeapObject());
   
   auto newbits = InlineRefCountBits(side);
@@ -26,7 +26,9 @@
 #include "swift/Runtime/Metadata.h"
 #include "swift/Runtime/Portability.h"
 #include "swift/Runtime/Reflection.h"
+#include "swift/Threading/Mutex.h"
 #include "swift/shims/Reflection.h"
+#include "llvm/ADT/DenseMap.h"
 #include <cassert>
 #include <cinttypes>
 #include <cstdio>
@@ -342,7 +344,7 @@ missing_reflection_metadata_warning(const char *fmt, ...) {
 }
 
 static std::pair<StringRef /*name*/, FieldType /*fieldInfo*/>
-getFieldAt(const Metadata *base, unsigned index) {
+getFieldAtImpl(const Metadata *base, unsigned index) {
   using namespace reflection;
   
   // If we failed to find the field descriptor metadata for the type, fall
@@ -413,6 +415,46 @@ getFieldAt(const Metadata *base, unsigned index) {
   return {name, fieldType};
 }
 
+static LazyMutex FieldCacheLock;
+
+/// Cache of resolved field information, keyed by (type metadata, field
+/// index).  Access MUST be protected using `FieldCacheLock`.
+///
+/// Resolving a field means demangling its type against the base type's
+/// generic arguments, which dominates the cost of mirroring; workloads that
+/// repeatedly mirror the same types (debug serializers, loggers) otherwise
+/// pay it on every Mirror creation.  Names point into the field descriptor
+/// and field types are complete metadata, so cached entries never go stale.
+static Lazy<llvm::DenseMap<std::pair<const Metadata *, unsigned>,
+                           std::pair<StringRef, FieldType>>>
+  FieldCache;
+
+static std::pair<StringRef /*name*/, FieldType /*fieldInfo*/>
+getFieldAt(const Metadata *base, unsigned index) {
+  auto key = std::make_pair(base, index);
+  auto &cache = FieldCache.get();
+
+  {
+    LazyMutex::ScopedLock guard(FieldCacheLock);
+    auto found = cache.find(key);
+    if (found != cache.end())
+      return found->second;
+  }
+
+  // Resolve outside the lock; resolution can re-enter the runtime and is
+  // idempotent, so racing threads at worst duplicate the work.
+  auto result = getFieldAtImpl(base, index);
+
+  // Don't cache the empty-tuple standins used on failure: they come with
+  // diagnostics that should repeat, and missing metadata may yet be
+  // registered by a later image load.
+  if (result.second.getType() != &METADATA_SYM(EMPTY_TUPLE_MANGLING)) {
+    LazyMutex::ScopedLock guard(FieldCacheLock);
+    cache.insert({key, result});
+  }
+  return result;
+}
+
 // Implementation for structs.
 struct StructImpl : ReflectionMirrorImpl {
   bool isReflectable() {
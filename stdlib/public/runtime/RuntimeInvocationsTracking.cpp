@@ -13,6 +13,17 @@
 // Track invocations of Swift runtime functions. This can be used for performance
 // analysis.
 //
+// This facility is a debugging tool, not a production telemetry source: it
+// is compiled out unless SWIFT_ENABLE_RUNTIME_FUNCTION_COUNTERS is defined,
+// and when compiled in it puts a test-and-increment (plus a lock, for the
+// per-object mode) on every tracked runtime entry point — including retain
+// and release — which is not a cost the runtime can carry by default.
+// Fleet-wide attribution of runtime traffic (e.g. a swift_conformsToProtocol
+// spike) is better served by external samplers: those entry points are
+// ordinary exported symbols that profilers can hit without the runtime
+// maintaining shared-memory counters or any reader/writer protocol of its
+// own.
+//
 //===----------------------------------------------------------------------===//
 
 #include <cstdint>
@@ -67,6 +67,17 @@ const void *SymbolInfo::getSymbolAddress() const {
 #endif
 }
 
+/// Note that this is a cold-path interface: callers are fatal-error
+/// reporting, debugging output, and the backtracer, not steady-state
+/// execution, so the lock-and-walk behavior of dladdr on Linux is tolerated
+/// rather than loved. A runtime-maintained sorted range table would make
+/// these lookups lock-free, but it cannot be built from the Swift image
+/// registration in ImageInspectionELF.cpp alone - that only sees images
+/// containing Swift sections, while crash addresses land in libc, vendored
+/// C++ and JITed frames too - so it would have to shadow every dlopen and
+/// dlclose in the process to be trustworthy. For high-volume symbolication,
+/// capture raw addresses plus image load offsets at crash time and resolve
+/// them offline.
 llvm::Optional<SymbolInfo> SymbolInfo::lookup(const void *address) {
   llvm::Optional<SymbolInfo> result;
 
@@ -76,6 +76,14 @@
 
 #include "llvm/ADT/StringExtras.h"
 
+/// Lookup table of two-character decimal representations of 0...99,
+/// used to emit two digits per division in the base-10 case below.
+static const char DecimalDigitPairs[201] =
+    "00010203040506070809101112131415161718192021222324"
+    "25262728293031323334353637383940414243444546474849"
+    "50515253545556575859606162636465666768697071727374"
+    "75767778798081828384858687888990919293949596979899";
+
 static uint64_t uint64ToStringImpl(char *Buffer, uint64_t Value,
                                    int64_t Radix, bool Uppercase,
                                    bool Negative) {
@@ -85,9 +93,22 @@ static uint64_t uint64ToStringImpl(char *Buffer, uint64_t Value,
   if (Y == 0) {
     *P++ = '0';
   } else if (Radix == 10) {
-    while (Y) {
-      *P++ = '0' + char(Y % 10);
-      Y /= 10;
+    // The 64-bit division dominates this loop, so emit two digits per
+    // division. Digits are produced least-significant first and reversed
+    // at the end, so the ones digit of each pair is written before the
+    // tens digit.
+    while (Y >= 100) {
+      unsigned Pair = unsigned(Y % 100) * 2;
+      Y /= 100;
+      *P++ = DecimalDigitPairs[Pair + 1];
+      *P++ = DecimalDigitPairs[Pair];
+    }
+    if (Y >= 10) {
+      unsigned Pair = unsigned(Y) * 2;
+      *P++ = DecimalDigitPairs[Pair + 1];
+      *P++ = DecimalDigitPairs[Pair];
+    } else {
+      *P++ = '0' + char(Y);
     }
   } else {
     unsigned Radix32 = Radix;
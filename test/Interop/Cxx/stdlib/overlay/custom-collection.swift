@@ -49,4 +49,19 @@ CxxCollectionTestSuite.test("SimpleArrayWrapper as Swift.Collection") {
   expectEqual(mapped.last, 51)
 }
 
+CxxCollectionTestSuite.test("SimpleArrayWrapper contiguous storage") {
+  let c = SimpleArrayWrapper()
+
+  // Containers with raw pointer iterators expose a zero-copy buffer view.
+  let sum = c.withUnsafeBufferPointer { buffer -> Int32 in
+    expectEqual(buffer.count, 5)
+    return buffer.reduce(0, +)
+  }
+  expectEqual(sum, 150)
+
+  // Array conversion from a contiguous container takes the bulk copy path.
+  let array = Array(c)
+  expectEqual([10, 20, 30, 40, 50] as [Int32], array)
+}
+
 runAllTests()
@@ -22,4 +22,22 @@ StdStringTestSuite.test("push back") {
     expectEqual(s[0], 42)
 }
 
+StdStringTestSuite.test("Swift String to C++ string") {
+    // Small enough for the C++ small-string buffer.
+    let short = CxxString("abc123")
+    expectEqual(short.size(), 6)
+    expectEqual(String(short), "abc123")
+
+    // Long enough to require a heap allocation on the C++ side.
+    let longValue = String(repeating: "ab", count: 256)
+    let long = CxxString(longValue)
+    expectEqual(long.size(), 512)
+    expectEqual(String(long), longValue)
+
+    // Non-ASCII content survives the round trip.
+    let unicode = CxxString("caf\u{E9}")
+    expectEqual(unicode.size(), 5)
+    expectEqual(String(unicode), "caf\u{E9}")
+}
+
 runAllTests()
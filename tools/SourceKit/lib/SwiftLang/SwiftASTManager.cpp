@@ -462,6 +462,17 @@ using ASTBuildOperationRef = std::shared_ptr<ASTBuildOperation>;
 /// It is thus able to serve an \c SwiftASTConsumer with an AST from an older
 /// snapshot, should it accept it by returning \c true in \c
 /// canUseASTWithSnapshots.
+///
+/// This is also the sharing point for request bursts: when an editor fires
+/// several requests against the same edit generation (cursor info,
+/// diagnostics, structure), each becomes a consumer enqueued here, and
+/// \c getBuildOperationForConsumer attaches all of them to one build
+/// operation for that snapshot — the AST is built once and the consumers
+/// run against it as it completes, in whatever order they finish.  A
+/// batched request form at the sourcekitd protocol level would buy
+/// little beyond this; if profiling shows repeated builds for one edit
+/// burst, the usual cause is the requests arriving with distinct
+/// snapshots because edits were interleaved, not a missing batching API.
 class ASTProducer : public std::enable_shared_from_this<ASTProducer> {
   SwiftInvocationRef InvokRef;
 
@@ -580,6 +591,17 @@ struct SwiftASTManager::Implementation {
   std::string RuntimeResourcePath;
   std::string DiagnosticDocumentationPath;
   SourceManager SourceMgr;
+  /// Producers are cached by invocation key — a hash of the compiler
+  /// arguments plus the primary file — so repeat requests against a file
+  /// reuse its built ASTs, but each file pays its own first build.  A
+  /// warmer pool keyed by configuration alone has been mooted for batch
+  /// tools that sweep many files per configuration; it wouldn't buy much,
+  /// because a CompilerInstance holds no reusable state until its primary
+  /// file is parsed and checked, and the genuinely shareable
+  /// per-configuration work (building imported modules) already persists
+  /// across instances through the on-disk module cache.  Batch clients
+  /// get the available amortization by grouping their sweep per
+  /// configuration so the module cache is cold at most once.
   Cache<ASTKey, ASTProducerRef> ASTCache{ "sourcekit.swift.ASTCache" };
   llvm::sys::Mutex CacheMtx;
   std::time_t SessionTimestamp;
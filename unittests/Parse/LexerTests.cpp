@@ -745,3 +745,35 @@ TEST_F(LexerTest, EncodedStringSegmentPastTheEnd) {
 }
 
 #endif // HAS_MMAP
+
+TEST_F(LexerTest, GetDamagedRegionForEdit) {
+  // Post-edit buffer; an edit replaced the range of "obar" (offsets 5..9).
+  const char *Source = "let foobar = 1 + 2\n";
+  unsigned BufID = SourceMgr.addMemBufferCopy(Source);
+
+  auto Damaged = Lexer::getDamagedRegionForEdit(
+      SourceMgr, BufID,
+      CharSourceRange(SourceMgr.getLocForOffset(BufID, 5), 4));
+  // The whole identifier is damaged, and the damage stops at the start of
+  // the '=' token.
+  EXPECT_EQ(SourceMgr.getLocForOffset(BufID, 4), Damaged.getStart());
+  EXPECT_EQ(SourceMgr.getLocForOffset(BufID, 11), Damaged.getEnd());
+}
+
+TEST_F(LexerTest, GetDamagedRegionForEditInBlockComment) {
+  // Post-edit buffer; an edit replaced one character inside the comment.
+  const char *Source = "a /* xx */ b\n";
+  unsigned BufID = SourceMgr.addMemBufferCopy(Source);
+
+  Lexer L(LangOpts, SourceMgr, BufID, /*Diags=*/nullptr, LexerMode::Swift,
+          HashbangMode::Allowed, CommentRetentionMode::ReturnAsTokens);
+  auto Anchor =
+      L.getStateForBeginningOfTokenLoc(SourceMgr.getLocForBufferStart(BufID));
+
+  auto Damaged = Lexer::getDamagedRegionForEdit(
+      SourceMgr, BufID,
+      CharSourceRange(SourceMgr.getLocForOffset(BufID, 6), 1), Anchor);
+  // The damage covers the comment containing the edit and stops at 'b'.
+  EXPECT_EQ(SourceMgr.getLocForOffset(BufID, 2), Damaged.getStart());
+  EXPECT_EQ(SourceMgr.getLocForOffset(BufID, 11), Damaged.getEnd());
+}
@@ -0,0 +1,161 @@
+//===--- CachingMemoryReader.cpp - Page cache tests -----------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2023 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#include "swift/Remote/CachingMemoryReader.h"
+#include "gtest/gtest.h"
+
+using namespace swift;
+using namespace swift::remote;
+
+namespace {
+
+/// A reader over a synthetic address range whose byte at address A is
+/// (A * 31 + 7) & 0xFF. Reads that touch anything outside
+/// [MappedBase, MappedBase + MappedSize) fail in full, mimicking a target
+/// whose mapping ends mid-page. Counts every readBytes call so tests can
+/// observe cache hits and misses.
+class MockMemoryReader final : public MemoryReader {
+public:
+  uint64_t MappedBase;
+  uint64_t MappedSize;
+  unsigned ReadCount = 0;
+
+  MockMemoryReader(uint64_t mappedBase, uint64_t mappedSize)
+      : MappedBase(mappedBase), MappedSize(mappedSize) {}
+
+  static uint8_t byteAt(uint64_t address) {
+    return static_cast<uint8_t>(address * 31 + 7);
+  }
+
+  bool queryDataLayout(DataLayoutQueryType type, void *inBuffer,
+                       void *outBuffer) override {
+    return false;
+  }
+
+  RemoteAddress getSymbolAddress(const std::string &name) override {
+    return RemoteAddress(nullptr);
+  }
+
+  bool readString(RemoteAddress address, std::string &dest) override {
+    return false;
+  }
+
+  bool readBytes(RemoteAddress address, uint8_t *dest,
+                 uint64_t size) override {
+    ++ReadCount;
+    uint64_t addr = address.getAddressData();
+    if (addr < MappedBase || addr + size > MappedBase + MappedSize)
+      return false;
+    for (uint64_t i = 0; i < size; ++i)
+      dest[i] = byteAt(addr + i);
+    return true;
+  }
+};
+
+static bool checkPattern(const uint8_t *bytes, uint64_t address,
+                         uint64_t size) {
+  for (uint64_t i = 0; i < size; ++i)
+    if (bytes[i] != MockMemoryReader::byteAt(address + i))
+      return false;
+  return true;
+}
+
+constexpr uint64_t PageSize = 4096;
+
+} // end anonymous namespace
+
+TEST(CachingMemoryReaderTest, CachesPages) {
+  auto Mock = std::make_shared<MockMemoryReader>(0, 64 * PageSize);
+  CachingMemoryReader Reader(Mock);
+
+  uint8_t buf[16];
+  ASSERT_TRUE(Reader.readBytes(RemoteAddress(0x100), buf, sizeof(buf)));
+  EXPECT_TRUE(checkPattern(buf, 0x100, sizeof(buf)));
+  EXPECT_EQ(1u, Mock->ReadCount);
+
+  // A second read from the same page must be served from the cache.
+  ASSERT_TRUE(Reader.readBytes(RemoteAddress(0x800), buf, sizeof(buf)));
+  EXPECT_TRUE(checkPattern(buf, 0x800, sizeof(buf)));
+  EXPECT_EQ(1u, Mock->ReadCount);
+}
+
+TEST(CachingMemoryReaderTest, AssemblesCrossPageReads) {
+  auto Mock = std::make_shared<MockMemoryReader>(0, 64 * PageSize);
+  CachingMemoryReader Reader(Mock);
+
+  // Straddle three pages; expect one underlying read per page and a
+  // correctly stitched result.
+  std::vector<uint8_t> buf(2 * PageSize + 32);
+  uint64_t start = PageSize - 16;
+  ASSERT_TRUE(Reader.readBytes(RemoteAddress(start), buf.data(), buf.size()));
+  EXPECT_TRUE(checkPattern(buf.data(), start, buf.size()));
+  EXPECT_EQ(4u, Mock->ReadCount);
+}
+
+TEST(CachingMemoryReaderTest, FallsBackOnPartialPages) {
+  // The mapping ends 64 bytes into the last page, so fetching that page in
+  // full fails and the reader must retry the exact requested range.
+  auto Mock = std::make_shared<MockMemoryReader>(0, 4 * PageSize + 64);
+  CachingMemoryReader Reader(Mock);
+
+  uint8_t buf[32];
+  uint64_t start = 4 * PageSize + 16;
+  ASSERT_TRUE(Reader.readBytes(RemoteAddress(start), buf, sizeof(buf)));
+  EXPECT_TRUE(checkPattern(buf, start, sizeof(buf)));
+  // One failed page fetch plus one exact-range fallback read.
+  EXPECT_EQ(2u, Mock->ReadCount);
+
+  // A range crossing past the end of the mapping still fails.
+  EXPECT_FALSE(
+      Reader.readBytes(RemoteAddress(4 * PageSize + 48), buf, sizeof(buf)));
+}
+
+TEST(CachingMemoryReaderTest, Flush) {
+  auto Mock = std::make_shared<MockMemoryReader>(0, 64 * PageSize);
+  CachingMemoryReader Reader(Mock);
+
+  uint8_t buf[8];
+  ASSERT_TRUE(Reader.readBytes(RemoteAddress(0x40), buf, sizeof(buf)));
+  EXPECT_EQ(1u, Mock->ReadCount);
+
+  Reader.flush();
+  ASSERT_TRUE(Reader.readBytes(RemoteAddress(0x40), buf, sizeof(buf)));
+  EXPECT_EQ(2u, Mock->ReadCount);
+}
+
+TEST(CachingMemoryReaderTest, EvictsLeastRecentlyUsed) {
+  constexpr size_t MaxPages = 4096;
+  auto Mock = std::make_shared<MockMemoryReader>(
+      0, (MaxPages + 2) * PageSize);
+  CachingMemoryReader Reader(Mock);
+
+  // Fill the cache to capacity.
+  uint8_t buf[8];
+  for (size_t page = 0; page < MaxPages; ++page)
+    ASSERT_TRUE(
+        Reader.readBytes(RemoteAddress(page * PageSize), buf, sizeof(buf)));
+  EXPECT_EQ(MaxPages, Mock->ReadCount);
+
+  // Touch page 0 so page 1 becomes the least recently used, then read one
+  // more page to force an eviction.
+  ASSERT_TRUE(Reader.readBytes(RemoteAddress(0), buf, sizeof(buf)));
+  EXPECT_EQ(MaxPages, Mock->ReadCount);
+  ASSERT_TRUE(
+      Reader.readBytes(RemoteAddress(MaxPages * PageSize), buf, sizeof(buf)));
+  EXPECT_EQ(MaxPages + 1, Mock->ReadCount);
+
+  // Page 0 must have survived; page 1 must have been evicted.
+  ASSERT_TRUE(Reader.readBytes(RemoteAddress(0), buf, sizeof(buf)));
+  EXPECT_EQ(MaxPages + 1, Mock->ReadCount);
+  ASSERT_TRUE(Reader.readBytes(RemoteAddress(PageSize), buf, sizeof(buf)));
+  EXPECT_EQ(MaxPages + 2, Mock->ReadCount);
+}